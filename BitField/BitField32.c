@@ -0,0 +1,361 @@
+/***************************************************************************//**
+ * @brief Word Sized Bit Field Library
+ * 
+ * @file BitField32.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See BitField32.h. A bit position is split into a word and a bit in
+ * that word with a shift and a mask, since the words are always 32 bits.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "BitField32.h"
+#include <string.h>
+
+// ***** Defines ***************************************************************
+
+#define WORD(bitPos)        ((bitPos) >> 5)
+#define BIT(bitPos)         ((bitPos) & 0x1F)
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+static inline uint32_t CountBits(uint32_t word);
+static inline uint32_t LowestBit(uint32_t word);
+static uint32_t RangeMask(uint32_t *endBitPos, uint32_t *startBitPos);
+
+// *****************************************************************************
+
+void BitField32_Init(BitField32 *self, uint32_t *ptrToArray, uint32_t sizeOfArray)
+{
+    if(ptrToArray == NULL || sizeOfArray == 0)
+        return;
+
+    self->ptrToArray = ptrToArray;
+    self->sizeOfArray = sizeOfArray;
+}
+
+// *****************************************************************************
+
+void BitField32_SetBit(BitField32 *self, uint32_t bitPos)
+{
+    if(self->ptrToArray == NULL || WORD(bitPos) >= self->sizeOfArray)
+        return;
+
+    self->ptrToArray[WORD(bitPos)] |= (1UL << BIT(bitPos));
+}
+
+// *****************************************************************************
+
+void BitField32_ClearBit(BitField32 *self, uint32_t bitPos)
+{
+    if(self->ptrToArray == NULL || WORD(bitPos) >= self->sizeOfArray)
+        return;
+
+    self->ptrToArray[WORD(bitPos)] &= ~(1UL << BIT(bitPos));
+}
+
+// *****************************************************************************
+
+void BitField32_InvertBit(BitField32 *self, uint32_t bitPos)
+{
+    if(self->ptrToArray == NULL || WORD(bitPos) >= self->sizeOfArray)
+        return;
+
+    self->ptrToArray[WORD(bitPos)] ^= (1UL << BIT(bitPos));
+}
+
+// *****************************************************************************
+
+uint8_t BitField32_GetBit(BitField32 *self, uint32_t bitPos)
+{
+    if(WORD(bitPos) >= self->sizeOfArray)
+        return 0;
+
+    return (self->ptrToArray[WORD(bitPos)] >> BIT(bitPos)) & 0x01;
+}
+
+// *****************************************************************************
+
+void BitField32_SetBitRangeEqualTo(BitField32 *self, uint32_t endBitPos, uint32_t startBitPos,
+    uint32_t literal)
+{
+    if(WORD(startBitPos) >= self->sizeOfArray || WORD(endBitPos) >= self->sizeOfArray)
+        return;
+
+    /* RangeMask can swap the start and end, so it has to be done before
+    startBitPos is used. Up to 32 bits can be split across two words. Line
+    them up in 64 bits and do both words at once. */
+    uint32_t rangeMask = RangeMask(&endBitPos, &startBitPos);
+    uint64_t mask = (uint64_t)rangeMask << BIT(startBitPos);
+    uint64_t value = ((uint64_t)literal << BIT(startBitPos)) & mask;
+    uint32_t i = WORD(startBitPos);
+
+    self->ptrToArray[i] = (self->ptrToArray[i] & ~(uint32_t)mask) | (uint32_t)value;
+
+    if(mask >> 32)
+    {
+        self->ptrToArray[i + 1] = (self->ptrToArray[i + 1] & ~(uint32_t)(mask >> 32)) |
+            (uint32_t)(value >> 32);
+    }
+}
+
+// *****************************************************************************
+
+uint32_t BitField32_GetBitRange(BitField32 *self, uint32_t endBitPos, uint32_t startBitPos)
+{
+    if(WORD(startBitPos) >= self->sizeOfArray || WORD(endBitPos) >= self->sizeOfArray)
+        return 0;
+
+    uint32_t mask = RangeMask(&endBitPos, &startBitPos);
+    uint32_t i = WORD(startBitPos);
+    uint64_t window = self->ptrToArray[i];
+
+    if(WORD(endBitPos) > i)
+        window |= (uint64_t)self->ptrToArray[i + 1] << 32;
+
+    return (uint32_t)(window >> BIT(startBitPos)) & mask;
+}
+
+// *****************************************************************************
+
+void BitField32_SetAll(BitField32 *self)
+{
+    for(uint32_t i = 0; i < self->sizeOfArray; i++)
+        self->ptrToArray[i] = 0xFFFFFFFF;
+}
+
+// *****************************************************************************
+
+void BitField32_ClearAll(BitField32 *self)
+{
+    for(uint32_t i = 0; i < self->sizeOfArray; i++)
+        self->ptrToArray[i] = 0;
+}
+
+// *****************************************************************************
+
+uint32_t BitField32_Count(BitField32 *self)
+{
+    uint32_t count = 0;
+
+    for(uint32_t i = 0; i < self->sizeOfArray; i++)
+        count += CountBits(self->ptrToArray[i]);
+
+    return count;
+}
+
+// *****************************************************************************
+
+uint32_t BitField32_FindFirstSet(BitField32 *self)
+{
+    for(uint32_t i = 0; i < self->sizeOfArray; i++)
+    {
+        if(self->ptrToArray[i])
+            return (i << 5) + LowestBit(self->ptrToArray[i]);
+    }
+    return BITFIELD32_NOT_FOUND;
+}
+
+// *****************************************************************************
+
+uint32_t BitField32_FindFirstClear(BitField32 *self)
+{
+    for(uint32_t i = 0; i < self->sizeOfArray; i++)
+    {
+        if(~self->ptrToArray[i])
+            return (i << 5) + LowestBit(~self->ptrToArray[i]);
+    }
+    return BITFIELD32_NOT_FOUND;
+}
+
+// *****************************************************************************
+
+uint32_t BitField32_FindNextSet(BitField32 *self, uint32_t bitPos)
+{
+    /* Start one past bitPos. Throw away the bits in that word up to and
+    including bitPos, then check the rest of the words like normal. */
+    if(bitPos == BITFIELD32_NOT_FOUND || WORD(bitPos) >= self->sizeOfArray)
+        return BITFIELD32_NOT_FOUND;
+
+    uint32_t i = WORD(bitPos);
+    uint32_t word = (BIT(bitPos) == 31) ? 0 :
+        self->ptrToArray[i] & (0xFFFFFFFF << (BIT(bitPos) + 1));
+
+    while(word == 0)
+    {
+        if(++i >= self->sizeOfArray)
+            return BITFIELD32_NOT_FOUND;
+        word = self->ptrToArray[i];
+    }
+    return (i << 5) + LowestBit(word);
+}
+
+// *****************************************************************************
+
+void BitField32_IteratorInit(BitField32Iterator *self, BitField32 *bitField)
+{
+    self->bitField = bitField;
+    self->index = 0;
+    self->bits = (bitField->sizeOfArray > 0) ? bitField->ptrToArray[0] : 0;
+}
+
+// *****************************************************************************
+
+bool BitField32_IteratorNext(BitField32Iterator *self, uint32_t *bitPos)
+{
+    while(self->bits == 0)
+    {
+        if(self->index + 1 >= self->bitField->sizeOfArray)
+            return false;
+        self->bits = self->bitField->ptrToArray[++self->index];
+    }
+
+    *bitPos = (self->index << 5) + LowestBit(self->bits);
+
+    /* Clear the lowest bit that is set */
+    self->bits &= self->bits - 1;
+    return true;
+}
+
+// *****************************************************************************
+
+uint8_t BitField32_Compare(BitField32 *bf1, BitField32 *bf2)
+{
+    if(bf1->sizeOfArray == bf2->sizeOfArray && memcmp(bf1->ptrToArray, bf2->ptrToArray,
+        bf1->sizeOfArray * sizeof(uint32_t)) == 0)
+        return 0;
+    else
+        return 1;
+}
+
+// *****************************************************************************
+
+void BitField32_LogicalNot(BitField32 *bf1, BitField32 *result)
+{
+    if(bf1->sizeOfArray != result->sizeOfArray)
+        return;
+
+    for(uint32_t i = 0; i < result->sizeOfArray; i++)
+        result->ptrToArray[i] = ~(bf1->ptrToArray[i]);
+}
+
+// *****************************************************************************
+
+void BitField32_LogicalAnd(BitField32 *bf1, BitField32 *bf2, BitField32 *result)
+{
+    if((bf1->sizeOfArray != bf2->sizeOfArray) || (bf1->sizeOfArray != result->sizeOfArray))
+        return;
+
+    for(uint32_t i = 0; i < result->sizeOfArray; i++)
+        result->ptrToArray[i] = (bf1->ptrToArray[i]) & (bf2->ptrToArray[i]);
+}
+
+// *****************************************************************************
+
+void BitField32_LogicalOr(BitField32 *bf1, BitField32 *bf2, BitField32 *result)
+{
+    if((bf1->sizeOfArray != bf2->sizeOfArray) || (bf1->sizeOfArray != result->sizeOfArray))
+        return;
+
+    for(uint32_t i = 0; i < result->sizeOfArray; i++)
+        result->ptrToArray[i] = (bf1->ptrToArray[i]) | (bf2->ptrToArray[i]);
+}
+
+// *****************************************************************************
+
+void BitField32_LogicalXor(BitField32 *bf1, BitField32 *bf2, BitField32 *result)
+{
+    if((bf1->sizeOfArray != bf2->sizeOfArray) || (bf1->sizeOfArray != result->sizeOfArray))
+        return;
+
+    for(uint32_t i = 0; i < result->sizeOfArray; i++)
+        result->ptrToArray[i] = (bf1->ptrToArray[i]) ^ (bf2->ptrToArray[i]);
+}
+
+// *****************************************************************************
+
+void BitField32_LogicalXnor(BitField32 *bf1, BitField32 *bf2, BitField32 *result)
+{
+    if((bf1->sizeOfArray != bf2->sizeOfArray) || (bf1->sizeOfArray != result->sizeOfArray))
+        return;
+
+    for(uint32_t i = 0; i < result->sizeOfArray; i++)
+        result->ptrToArray[i] = ~((bf1->ptrToArray[i]) ^ (bf2->ptrToArray[i]));
+}
+
+// *****************************************************************************
+
+static inline uint32_t CountBits(uint32_t word)
+{
+    /* The long versions of the builtins, because an int is only 16 bits on
+    some micros. A long is always at least 32. */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(BITFIELD32_NO_BUILTINS)
+    return (uint32_t)__builtin_popcountl(word);
+#else
+    word = word - ((word >> 1) & 0x55555555);
+    word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+    word = (word + (word >> 4)) & 0x0F0F0F0F;
+    return (word * 0x01010101) >> 24;
+#endif
+}
+
+// *****************************************************************************
+
+static inline uint32_t LowestBit(uint32_t word)
+{
+    /* The word must not be zero */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(BITFIELD32_NO_BUILTINS)
+    return (uint32_t)__builtin_ctzl(word);
+#else
+    uint32_t bit = 0;
+
+    /* Keep only the lowest bit, then find which one it is by halves */
+    word &= -word;
+    if(word & 0xFFFF0000) bit += 16;
+    if(word & 0xFF00FF00) bit += 8;
+    if(word & 0xF0F0F0F0) bit += 4;
+    if(word & 0xCCCCCCCC) bit += 2;
+    if(word & 0xAAAAAAAA) bit += 1;
+    return bit;
+#endif
+}
+
+// *****************************************************************************
+
+static uint32_t RangeMask(uint32_t *endBitPos, uint32_t *startBitPos)
+{
+    /* Put the start and end in order, and make a mask for the range, right
+    justified. No more than 32 bits. */
+    if(*startBitPos > *endBitPos)
+    {
+        uint32_t tmp = *endBitPos;
+        *endBitPos = *startBitPos;
+        *startBitPos = tmp;
+    }
+
+    if(*endBitPos - *startBitPos >= 31)
+    {
+        *endBitPos = *startBitPos + 31;
+        return 0xFFFFFFFF;
+    }
+    return (1UL << (*endBitPos - *startBitPos + 1)) - 1;
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,382 @@
+/***************************************************************************//**
+ * @brief Word Sized Bit Field Library Header File
+ * 
+ * @file BitField32.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      This is the same idea as BitField.h, but the bits are kept in an array
+ * of uint32_t instead of bytes, and the bit positions are 32 bits. The
+ * original one tops out at 256 bits, which is plenty for a few inputs, but
+ * not for something like thousands of channel enables or fault flags. The
+ * functions work on a whole word at a time wherever they can.
+ * 
+ * There are a few extra functions for dealing with a lot of bits.
+ * BitField32_Count tells you how many bits are set. The find functions give
+ * you the position of the first set bit, the first clear bit, or the next set
+ * bit after a certain position. To go through every bit that is set, use an
+ * iterator. It skips over words that are all zero, and it only looks at the
+ * bits that are set, so if you have 4000 faults to check and only two are
+ * active, it doesn't check the other 3998.
+ * 
+ * With GCC or Clang, counting and finding bits is done with
+ * __builtin_popcount and __builtin_ctz, which turn into a single instruction
+ * on most processors. On a Cortex-M3 and up, that is RBIT and CLZ. Other
+ * compilers get a plain C version that does the same thing. On a core with
+ * no instruction for it, GCC calls a library function instead, which can be
+ * slower than the plain C version. Define BITFIELD32_NO_BUILTINS to use the
+ * plain C version anyway.
+ * 
+ * Bit 0 is the LSB of the first word. The size is given as the number of
+ * words in the array, so every bit in every word is part of the bit field. If
+ * your number of bits isn't a multiple of 32, the extra bits at the end are
+ * still there. Leave them clear and they won't show up as set.
+ * BitField32_FindFirstClear can find one of them though.
+ * 
+ * @section example_code Example Code
+ * 
+ *      enum { FAULT_OVER_VOLTAGE = 0, FAULT_OVER_CURRENT, ..., TOTAL };
+ *      uint32_t faultArray[TOTAL / 32 + 1];
+ *      BitField32 faults;
+ *      BitField32Iterator iterator;
+ *      uint32_t bitPos;
+ * 
+ *      BitField32_Init(&faults, faultArray, sizeof(faultArray) / sizeof(uint32_t));
+ *      BitField32_SetBit(&faults, FAULT_OVER_CURRENT);
+ * 
+ *      BitField32_IteratorInit(&iterator, &faults);
+ *      while(BitField32_IteratorNext(&iterator, &bitPos))
+ *      {
+ *          // handle fault number bitPos
+ *      }
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef BITFIELD32_H
+#define BITFIELD32_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ***** Defines ***************************************************************
+
+/* What the find functions give you if there is no bit to find */
+#define BITFIELD32_NOT_FOUND    UINT32_MAX
+
+// ***** Global Variables ******************************************************
+
+typedef struct BitField32Tag
+{
+    uint32_t *ptrToArray;
+    uint32_t sizeOfArray;
+} BitField32;
+
+/**
+ * Description of struct members
+ * 
+ * ptrToArray  pointer to the array of words that holds the bits
+ * 
+ * sizeOfArray  the number of words in the array, not the number of bytes
+ */
+
+typedef struct BitField32IteratorTag
+{
+    BitField32 *bitField;
+    uint32_t index;
+    uint32_t bits;
+} BitField32Iterator;
+
+/**
+ * Description of struct members
+ * 
+ * bitField  the BitField32 that you are going through
+ * 
+ * index  the word that the iterator is on
+ * 
+ * bits  a copy of that word with the bits that were already given out
+ *       cleared. When it gets to zero, the iterator moves to the next word.
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initialize a BitField32
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param ptrToArray  pointer to the array you are going to use
+ * 
+ * @param sizeOfArray  number of uint32_t in said array
+ */
+void BitField32_Init(BitField32 *self, uint32_t *ptrToArray, uint32_t sizeOfArray);
+
+/***************************************************************************//**
+ * @brief Set a bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position of the bit in the mask. LSB = 0
+ */
+void BitField32_SetBit(BitField32 *self, uint32_t bitPos);
+
+/***************************************************************************//**
+ * @brief Clear a bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position of the bit in the mask. LSB = 0
+ */
+void BitField32_ClearBit(BitField32 *self, uint32_t bitPos);
+
+/***************************************************************************//**
+ * @brief Invert a bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position of the bit in the mask. LSB = 0
+ */
+void BitField32_InvertBit(BitField32 *self, uint32_t bitPos);
+
+/***************************************************************************//**
+ * @brief Write a bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position of the bit in the mask. LSB = 0
+ * 
+ * @param value  true = set, false = clear
+ */
+static inline void BitField32_WriteBit(BitField32 *self, uint32_t bitPos, bool value)
+{
+    if(value)
+        BitField32_SetBit(self, bitPos);
+    else
+        BitField32_ClearBit(self, bitPos);
+}
+
+/***************************************************************************//**
+ * @brief Get a bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position of the bit in the mask. LSB = 0
+ * 
+ * @return uint8_t  the value of the bit, either 0x01 or 0x00
+ */
+uint8_t BitField32_GetBit(BitField32 *self, uint32_t bitPos);
+
+/***************************************************************************//**
+ * @brief Set a range of bits
+ * 
+ * Works the same as BitField_SetBitRangeEqualTo. The start and end of the
+ * range can be in whatever order you like. The LSB of the literal goes in the
+ * lower bit position. If the range is more than 32 bits, only the first 32
+ * are changed. The start and end bit numbers must be smaller than the size of
+ * the bitfield.
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param endBitPos  the bit number of the end of the range
+ * 
+ * @param startBitPos  the bit number of the start of the range
+ * 
+ * @param literal  the value that you want the bits set to
+ */
+void BitField32_SetBitRangeEqualTo(BitField32 *self, uint32_t endBitPos, uint32_t startBitPos,
+    uint32_t literal);
+
+/***************************************************************************//**
+ * @brief Get a range of bits
+ * 
+ * The start and end of the range can be in whatever order you like. The result
+ * is right justified. If you ask for more than 32 bits, you will still get
+ * 32 bits. The start and end bit numbers must be smaller than the size of the
+ * bitfield.
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param endBitPos  the bit number of the end of the range
+ * 
+ * @param startBitPos  the bit number of the start of the range
+ * 
+ * @return uint32_t  result (truncated if larger than 32)
+ */
+uint32_t BitField32_GetBitRange(BitField32 *self, uint32_t endBitPos, uint32_t startBitPos);
+
+/***************************************************************************//**
+ * @brief Set every bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ */
+void BitField32_SetAll(BitField32 *self);
+
+/***************************************************************************//**
+ * @brief Clear every bit
+ * 
+ * @param self  pointer to the BitField32 you are using
+ */
+void BitField32_ClearAll(BitField32 *self);
+
+/***************************************************************************//**
+ * @brief Count the number of bits that are set
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @return uint32_t  number of bits that are 1
+ */
+uint32_t BitField32_Count(BitField32 *self);
+
+/***************************************************************************//**
+ * @brief Find the lowest bit that is set
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @return uint32_t  bit position, or BITFIELD32_NOT_FOUND if every bit is 0
+ */
+uint32_t BitField32_FindFirstSet(BitField32 *self);
+
+/***************************************************************************//**
+ * @brief Find the lowest bit that is clear
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @return uint32_t  bit position, or BITFIELD32_NOT_FOUND if every bit is 1
+ */
+uint32_t BitField32_FindFirstClear(BitField32 *self);
+
+/***************************************************************************//**
+ * @brief Find the next bit that is set after a certain position
+ * 
+ * The bit at bitPos itself isn't included, so you can pass in the last bit
+ * that you found to get the one after it.
+ * 
+ * @param self  pointer to the BitField32 you are using
+ * 
+ * @param bitPos  the position to start looking after
+ * 
+ * @return uint32_t  bit position, or BITFIELD32_NOT_FOUND if there are no
+ *                   more bits set
+ */
+uint32_t BitField32_FindNextSet(BitField32 *self, uint32_t bitPos);
+
+/***************************************************************************//**
+ * @brief Start going through the bits that are set
+ * 
+ * The iterator reads each word when it gets to it. If you change a word that
+ * the iterator is already on, it won't see the change.
+ * 
+ * @param self  pointer to the BitField32Iterator you are using
+ * 
+ * @param bitField  pointer to the BitField32 to go through
+ */
+void BitField32_IteratorInit(BitField32Iterator *self, BitField32 *bitField);
+
+/***************************************************************************//**
+ * @brief Get the next bit that is set
+ * 
+ * Gives you the bits from lowest to highest.
+ * 
+ * @param self  pointer to the BitField32Iterator you are using
+ * 
+ * @param bitPos  where the position of the bit goes
+ * 
+ * @return bool  true if there was another bit, false if there are no more
+ */
+bool BitField32_IteratorNext(BitField32Iterator *self, uint32_t *bitPos);
+
+/***************************************************************************//**
+ * @brief Compare two BitField32s
+ * 
+ * @param bf1  pointer to the first BitField32
+ * 
+ * @param bf2  pointer to the second BitField32
+ * 
+ * @return uint8_t  0 bf1 is equal to bf2
+ */
+uint8_t BitField32_Compare(BitField32 *bf1, BitField32 *bf2);
+
+/***************************************************************************//**
+ * @brief Invert a BitField32 and store the result
+ * 
+ * The operands must be the same size. The result can be stored in the same
+ * BitField32 if desired.
+ * 
+ * @param bf1  the BitField32 that you want to invert
+ * 
+ * @param result  the BitField32 where the result will be placed
+ */
+void BitField32_LogicalNot(BitField32 *bf1, BitField32 *result);
+
+/***************************************************************************//**
+ * @brief Take the logical AND of two BitField32s and store the result
+ * 
+ * The operands must be the same size. The result can be stored in one of the
+ * same BitField32s if desired.
+ * 
+ * @param bf1  BitField32 operand one
+ * 
+ * @param bf2  BitField32 operand two
+ * 
+ * @param result  the BitField32 where the result will be placed
+ */
+void BitField32_LogicalAnd(BitField32 *bf1, BitField32 *bf2, BitField32 *result);
+
+/***************************************************************************//**
+ * @brief Take the logical OR of two BitField32s and store the result
+ * 
+ * The operands must be the same size. The result can be stored in one of the
+ * same BitField32s if desired.
+ * 
+ * @param bf1  BitField32 operand one
+ * 
+ * @param bf2  BitField32 operand two
+ * 
+ * @param result  the BitField32 where the result will be placed
+ */
+void BitField32_LogicalOr(BitField32 *bf1, BitField32 *bf2, BitField32 *result);
+
+/***************************************************************************//**
+ * @brief Take the logical XOR of two BitField32s and store the result
+ * 
+ * The operands must be the same size. The result can be stored in one of the
+ * same BitField32s if desired.
+ * 
+ * @param bf1  BitField32 operand one
+ * 
+ * @param bf2  BitField32 operand two
+ * 
+ * @param result  the BitField32 where the result will be placed
+ */
+void BitField32_LogicalXor(BitField32 *bf1, BitField32 *bf2, BitField32 *result);
+
+/***************************************************************************//**
+ * @brief Take the logical XNOR of two BitField32s and store the result
+ * 
+ * The operands must be the same size. The result can be stored in one of the
+ * same BitField32s if desired.
+ * 
+ * @param bf1  BitField32 operand one
+ * 
+ * @param bf2  BitField32 operand two
+ * 
+ * @param result  the BitField32 where the result will be placed
+ */
+void BitField32_LogicalXnor(BitField32 *bf1, BitField32 *bf2, BitField32 *result);
+
+#endif /* BITFIELD32_H */
@@ -0,0 +1,288 @@
+/* Program to test BitField32 - MS
+
+   Does a lot of random sets, clears, inverts, and ranges on a BitField32
+   and on a plain array of bools side by side, and checks that every
+   function gives the same answer as working it out from the bools one bit
+   at a time. The sizes include one word and sizes that aren't a multiple of
+   8 words. Then times counting and going through 4096 fault bits with only a
+   few set, using GetBit on every bit against BitField32_Count and the
+   iterator. Returns 1 if anything doesn't match.
+
+   To check the plain C versions of the bit counting instead of the
+   builtins, add -DBITFIELD32_NO_BUILTINS.
+
+   gcc -O2 TestBitField32.c BitField32.c -o TestBitField32
+   ./TestBitField32 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "BitField32.h"
+
+#define MAX_WORDS           131
+#define NUM_OPERATIONS      20000
+#define NUM_FAULT_BITS      4096
+#define NUM_TIMING_LOOPS    20000
+
+static uint32_t array[MAX_WORDS], array2[MAX_WORDS], array3[MAX_WORDS];
+static bool reference[MAX_WORDS * 32];
+static int errors;
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void Check(bool ok, const char *what, uint32_t numWords, uint32_t operation)
+{
+    if(!ok && errors++ < 20)
+        printf("FAIL %s, %u words, operation %u\n", what, numWords, operation);
+}
+
+static void CheckAll(BitField32 *bf, uint32_t numWords, uint32_t operation)
+{
+    uint32_t numBits = numWords * 32, count = 0, firstSet = BITFIELD32_NOT_FOUND;
+    uint32_t firstClear = BITFIELD32_NOT_FOUND, bitPos, next = 0;
+    BitField32Iterator iterator;
+
+    for(uint32_t i = numBits; i > 0; i--)
+    {
+        if(reference[i - 1])
+        {
+            count++;
+            firstSet = i - 1;
+        }
+        else
+        {
+            firstClear = i - 1;
+        }
+        if(BitField32_GetBit(bf, i - 1) != reference[i - 1])
+        {
+            Check(false, "GetBit", numWords, operation);
+            break;
+        }
+    }
+
+    Check(BitField32_Count(bf) == count, "Count", numWords, operation);
+    Check(BitField32_FindFirstSet(bf) == firstSet, "FindFirstSet", numWords, operation);
+    Check(BitField32_FindFirstClear(bf) == firstClear, "FindFirstClear", numWords, operation);
+
+    /* The iterator and FindNextSet should both land on every set bit */
+    BitField32_IteratorInit(&iterator, bf);
+    for(uint32_t i = 0; i < numBits; i++)
+    {
+        if(!reference[i])
+            continue;
+
+        if(!BitField32_IteratorNext(&iterator, &bitPos) || bitPos != i)
+        {
+            Check(false, "IteratorNext", numWords, operation);
+            return;
+        }
+        next = (i == firstSet) ? BitField32_FindFirstSet(bf) : BitField32_FindNextSet(bf, next);
+        if(next != i)
+        {
+            Check(false, "FindNextSet", numWords, operation);
+            return;
+        }
+    }
+    Check(!BitField32_IteratorNext(&iterator, &bitPos), "IteratorNext end", numWords,
+        operation);
+    Check(count == 0 || BitField32_FindNextSet(bf, next) == BITFIELD32_NOT_FOUND,
+        "FindNextSet end", numWords, operation);
+}
+
+int main(void)
+{
+    const uint32_t sizes[] = {1, 2, 3, 8, 9, 64, MAX_WORDS};
+    BitField32 bf, bf2, bf3;
+
+    srand(1);
+
+    for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        uint32_t numWords = sizes[s], numBits = numWords * 32;
+
+        BitField32_Init(&bf, array, numWords);
+        BitField32_ClearAll(&bf);
+        memset(reference, 0, sizeof(reference));
+
+        for(uint32_t op = 0; op < NUM_OPERATIONS; op++)
+        {
+            uint32_t bitPos = rand() % numBits;
+            uint32_t endBitPos = (bitPos + rand() % 40) % numBits;
+            uint32_t literal = ((uint32_t)rand() << 16) ^ rand();
+
+            switch(rand() % 6)
+            {
+                case 0:
+                    BitField32_SetBit(&bf, bitPos);
+                    reference[bitPos] = true;
+                    break;
+                case 1:
+                    BitField32_ClearBit(&bf, bitPos);
+                    reference[bitPos] = false;
+                    break;
+                case 2:
+                    BitField32_InvertBit(&bf, bitPos);
+                    reference[bitPos] = !reference[bitPos];
+                    break;
+                case 3:
+                    BitField32_WriteBit(&bf, bitPos, literal & 1);
+                    reference[bitPos] = literal & 1;
+                    break;
+                case 4:
+                {
+                    /* Either order. Only the first 32 bits of the range. */
+                    uint32_t low = (bitPos < endBitPos) ? bitPos : endBitPos;
+                    uint32_t high = (bitPos < endBitPos) ? endBitPos : bitPos;
+
+                    if(high - low > 31)
+                        high = low + 31;
+                    if(rand() & 1)
+                        BitField32_SetBitRangeEqualTo(&bf, endBitPos, bitPos, literal);
+                    else
+                        BitField32_SetBitRangeEqualTo(&bf, bitPos, endBitPos, literal);
+                    for(uint32_t i = low; i <= high; i++)
+                        reference[i] = (literal >> (i - low)) & 1;
+                    break;
+                }
+                default:
+                {
+                    uint32_t low = (bitPos < endBitPos) ? bitPos : endBitPos;
+                    uint32_t high = (bitPos < endBitPos) ? endBitPos : bitPos;
+                    uint32_t expected = 0;
+
+                    if(high - low > 31)
+                        high = low + 31;
+                    for(uint32_t i = low; i <= high; i++)
+                        expected |= (uint32_t)reference[i] << (i - low);
+                    Check(BitField32_GetBitRange(&bf, bitPos, endBitPos) == expected,
+                        "GetBitRange", numWords, op);
+                    break;
+                }
+            }
+
+            /* Out of range positions don't do anything */
+            BitField32_SetBit(&bf, numBits + op);
+            BitField32_InvertBit(&bf, BITFIELD32_NOT_FOUND);
+
+            if(op % 97 == 0 || op < 64)
+                CheckAll(&bf, numWords, op);
+        }
+
+        /* All set, and all clear */
+        BitField32_SetAll(&bf);
+        memset(reference, 1, numBits);
+        CheckAll(&bf, numWords, NUM_OPERATIONS);
+        BitField32_ClearAll(&bf);
+        memset(reference, 0, numBits);
+        CheckAll(&bf, numWords, NUM_OPERATIONS + 1);
+
+        /* The logic functions against doing it one bit at a time */
+        BitField32_Init(&bf2, array2, numWords);
+        BitField32_Init(&bf3, array3, numWords);
+        for(uint32_t i = 0; i < numWords; i++)
+        {
+            array[i] = ((uint32_t)rand() << 16) ^ rand();
+            array2[i] = ((uint32_t)rand() << 16) ^ rand();
+        }
+        for(uint32_t op = 0; op < 5; op++)
+        {
+            if(op == 0)
+                BitField32_LogicalNot(&bf, &bf3);
+            else if(op == 1)
+                BitField32_LogicalAnd(&bf, &bf2, &bf3);
+            else if(op == 2)
+                BitField32_LogicalOr(&bf, &bf2, &bf3);
+            else if(op == 3)
+                BitField32_LogicalXor(&bf, &bf2, &bf3);
+            else
+                BitField32_LogicalXnor(&bf, &bf2, &bf3);
+
+            for(uint32_t i = 0; i < numBits; i++)
+            {
+                bool a = BitField32_GetBit(&bf, i), b = BitField32_GetBit(&bf2, i);
+                bool expected = (op == 0) ? !a : (op == 1) ? (a && b) : (op == 2) ? (a || b) :
+                    (op == 3) ? (a != b) : (a == b);
+                reference[i] = expected;
+            }
+            CheckAll(&bf3, numWords, op);
+        }
+        Check(BitField32_Compare(&bf, &bf) == 0 && BitField32_Compare(&bf, &bf2) == 1,
+            "Compare", numWords, 0);
+    }
+
+    /* Start after the end. A literal of 1 has to land on the lower bit
+    position, inside one word and across two. */
+    const uint32_t reversed[][3] = {{22, 27, 0x00400000}, {30, 40, 0x40000000}};
+    for(uint32_t r = 0; r < 2; r++)
+    {
+        BitField32_Init(&bf, array, 2);
+        BitField32_ClearAll(&bf);
+        BitField32_SetBitRangeEqualTo(&bf, reversed[r][0], reversed[r][1], 1);
+        Check(array[0] == reversed[r][2] && array[1] == 0 &&
+            BitField32_GetBitRange(&bf, reversed[r][0], reversed[r][1]) == 1,
+            "SetBitRangeEqualTo reversed", 2, r);
+    }
+
+    /* Timing. 4096 fault bits with 5 of them set. */
+    static uint32_t faultArray[NUM_FAULT_BITS / 32];
+    volatile uint32_t sink = 0;
+    double seconds[4];
+    BitField32Iterator iterator;
+    uint32_t bitPos;
+
+    BitField32_Init(&bf, faultArray, NUM_FAULT_BITS / 32);
+    BitField32_SetBit(&bf, 3);
+    BitField32_SetBit(&bf, 700);
+    BitField32_SetBit(&bf, 701);
+    BitField32_SetBit(&bf, 2500);
+    BitField32_SetBit(&bf, 4095);
+
+    for(uint32_t test = 0; test < 4; test++)
+    {
+        double start = Seconds();
+        uint32_t sum = 0;
+
+        for(uint32_t loop = 0; loop < NUM_TIMING_LOOPS; loop++)
+        {
+            if(test == 0)
+            {
+                for(uint32_t i = 0; i < NUM_FAULT_BITS; i++)
+                    sum += BitField32_GetBit(&bf, i);
+            }
+            else if(test == 1)
+            {
+                sum += BitField32_Count(&bf);
+            }
+            else if(test == 2)
+            {
+                for(uint32_t i = 0; i < NUM_FAULT_BITS; i++)
+                {
+                    if(BitField32_GetBit(&bf, i))
+                        sum += i;
+                }
+            }
+            else
+            {
+                BitField32_IteratorInit(&iterator, &bf);
+                while(BitField32_IteratorNext(&iterator, &bitPos))
+                    sum += bitPos;
+            }
+        }
+        sink += sum;
+        seconds[test] = Seconds() - start;
+    }
+
+    printf("GetBit count ns,BitField32_Count ns,GetBit scan ns,iterator ns\n");
+    printf("%.1f,%.1f,%.1f,%.1f\n", seconds[0] * 1e9 / NUM_TIMING_LOOPS,
+        seconds[1] * 1e9 / NUM_TIMING_LOOPS, seconds[2] * 1e9 / NUM_TIMING_LOOPS,
+        seconds[3] * 1e9 / NUM_TIMING_LOOPS);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
@@ -8,6 +8,10 @@
  * @date 4/1/19    Original creation
  * @date 10/5/21   Updated documention
  * @date 5/16/22   Fixed bug with tail not getting updated with circular inc
+ * @date 10/16/26  Added array functions
+ * @date 10/16/26  Added region functions for zero-copy access
+ * @date 10/16/26  Added search functions
+ * @date 10/16/26  Added optional statistics
  * 
  * @details
  *      A basic 8-bit ring buffer. To create a buffer, the minimum you will 
@@ -24,6 +28,7 @@
  ******************************************************************************/
 
 #include "Buffer.h"
+#include <string.h>
 
 // ***** Defines ***************************************************************
 
@@ -37,6 +42,11 @@
 
 // ***** Static Function Prototypes ********************************************
 
+static uint16_t CopyOut(Buffer *self, uint8_t *array, uint16_t length);
+static bool FindByteFrom(Buffer *self, uint8_t value, uint16_t start, uint16_t *offset);
+static inline uint8_t ByteAtOffset(Buffer *self, uint16_t offset);
+static inline void RecordWrite(Buffer *self, uint16_t numBytesIn, uint16_t numBytesDropped);
+static inline void RecordRead(Buffer *self, uint16_t numBytesOut);
 
 // *****************************************************************************
 
@@ -53,6 +63,7 @@ void Buffer_InitWithOverwrite(Buffer *self, uint8_t *arrayIn, uint8_t arrayInSiz
     self->private.size = arrayInSize;
     self->enableOverwrite = overwrite;
     self->count = 0;
+    Buffer_ResetStats(self);
 }
 
 // *****************************************************************************
@@ -67,6 +78,7 @@ void Buffer_WriteByte(Buffer *self, uint8_t receivedByte)
         self->private.buffer[self->private.head] = receivedByte;
         self->private.head = tempHead;
         self->count++;
+        RecordWrite(self, 1, 0);
     }
     else if(self->enableOverwrite)
     {
@@ -75,6 +87,7 @@ void Buffer_WriteByte(Buffer *self, uint8_t receivedByte)
         self->private.head = tempHead; // Mark the next space to be overwritten
         self->private.tail = CircularIncrement(self->private.tail, self->private.size); // Move the tail up one
         self->overflow = true;
+        RecordWrite(self, 1, 1);
     }
     else
     {
@@ -86,6 +99,7 @@ void Buffer_WriteByte(Buffer *self, uint8_t receivedByte)
         }
         
         self->overflow = true; // Notify of overflow
+        RecordWrite(self, 0, 1);
         
         if(self->private.bufferOverflowCallbackFunc)
         {
@@ -107,6 +121,7 @@ uint8_t Buffer_ReadByte(Buffer *self)
         self->private.tail = CircularIncrement(self->private.tail, self->private.size);
         self->count--;
         self->overflow = false;
+        RecordRead(self, 1);
     }
     return dataToReturn;
 }
@@ -128,6 +143,7 @@ uint8_t Buffer_Peek(Buffer *self)
 
 void Buffer_Flush(Buffer *self)
 {
+    RecordRead(self, self->count);
     self->private.tail = self->private.head;
     self->count = 0;
 }
@@ -183,6 +199,355 @@ void Buffer_SetOverflowCallback(Buffer *self, BufferOverflowCallbackFunc Functio
     self->private.bufferOverflowCallbackFunc = Function;
 }
 
+// *****************************************************************************
+
+uint16_t Buffer_WriteArray(Buffer *self, const uint8_t *array, uint16_t length)
+{
+    uint16_t capacity = self->private.size - 1;
+    uint16_t space = capacity - self->count;
+    uint16_t written;
+    uint16_t dropped = 0;
+
+    if(length > space)
+    {
+        if(self->enableOverwrite)
+        {
+            /* Only the newest bytes will fit. Skip the ones that would just 
+            be overwritten anyways, then move the tail up to make room. */
+            if(length > capacity)
+            {
+                dropped = length - capacity;
+                array += dropped;
+                length = capacity;
+            }
+            uint16_t drop = length - space;
+            dropped += drop;
+            self->private.tail += drop;
+            if(self->private.tail >= self->private.size)
+                self->private.tail -= self->private.size;
+            self->count -= drop;
+            space = length;
+            self->overflow = true;
+        }
+        else
+        {
+            self->overflow = true;
+            dropped = length - space;
+            
+            if(self->private.bufferOverflowCallbackFunc)
+            {
+                self->private.bufferOverflowCallbackFunc();
+            }
+        }
+    }
+
+    written = (length < space) ? length : space;
+
+    /* The copy is split at the end of the array. At most two memcpy's. */
+    uint16_t head = self->private.head;
+    uint16_t firstPart = self->private.size - head;
+    
+    if(firstPart > written)
+        firstPart = written;
+
+    memcpy(&self->private.buffer[head], array, firstPart);
+    memcpy(&self->private.buffer[0], array + firstPart, written - firstPart);
+
+    head += written;
+    if(head >= self->private.size)
+        head -= self->private.size;
+
+    self->private.head = head;
+    self->count += written;
+    RecordWrite(self, written, dropped);
+    return written;
+}
+
+// *****************************************************************************
+
+uint16_t Buffer_ReadArray(Buffer *self, uint8_t *array, uint16_t length)
+{
+    uint16_t numRead = CopyOut(self, array, length);
+
+    if(numRead > 0)
+    {
+        uint16_t tail = self->private.tail + numRead;
+        if(tail >= self->private.size)
+            tail -= self->private.size;
+
+        self->private.tail = tail;
+        self->count -= numRead;
+        self->overflow = false;
+        RecordRead(self, numRead);
+    }
+    return numRead;
+}
+
+// *****************************************************************************
+
+uint16_t Buffer_PeekArray(Buffer *self, uint8_t *array, uint16_t length)
+{
+    return CopyOut(self, array, length);
+}
+
+// *****************************************************************************
+
+void Buffer_GetWriteRegion(Buffer *self, uint8_t **region, uint16_t *length)
+{
+    uint16_t head = self->private.head;
+    uint16_t tail = self->private.tail;
+
+    /* The free space starts at the head and runs until the slot just before 
+    the tail or the end of the array, whichever comes first. */
+    if(tail > head)
+        *length = tail - head - 1;
+    else if(tail == 0)
+        *length = self->private.size - head - 1;
+    else
+        *length = self->private.size - head;
+
+    *region = &self->private.buffer[head];
+}
+
+// *****************************************************************************
+
+void Buffer_CommitWrite(Buffer *self, uint16_t numBytes)
+{
+    uint16_t space = (self->private.size - 1) - self->count;
+
+    if(numBytes > space)
+        numBytes = space;
+
+    uint16_t head = self->private.head + numBytes;
+    if(head >= self->private.size)
+        head -= self->private.size;
+
+    self->private.head = head;
+    self->count += numBytes;
+    RecordWrite(self, numBytes, 0);
+}
+
+// *****************************************************************************
+
+void Buffer_GetReadRegion(Buffer *self, uint8_t **region, uint16_t *length)
+{
+    uint16_t head = self->private.head;
+    uint16_t tail = self->private.tail;
+
+    /* The data starts at the tail and runs until the head or the end of the 
+    array, whichever comes first. */
+    if(head >= tail)
+        *length = head - tail;
+    else
+        *length = self->private.size - tail;
+
+    *region = &self->private.buffer[tail];
+}
+
+// *****************************************************************************
+
+void Buffer_ReleaseRead(Buffer *self, uint16_t numBytes)
+{
+    if(numBytes > self->count)
+        numBytes = self->count;
+
+    if(numBytes > 0)
+    {
+        uint16_t tail = self->private.tail + numBytes;
+        if(tail >= self->private.size)
+            tail -= self->private.size;
+
+        self->private.tail = tail;
+        self->count -= numBytes;
+        self->overflow = false;
+        RecordRead(self, numBytes);
+    }
+}
+
+// *****************************************************************************
+
+bool Buffer_FindByte(Buffer *self, uint8_t value, uint16_t *offset)
+{
+    return FindByteFrom(self, value, 0, offset);
+}
+
+// *****************************************************************************
+
+bool Buffer_FindSequence(Buffer *self, const uint8_t *sequence, uint16_t length, uint16_t *offset)
+{
+    uint16_t start = 0;
+    uint16_t match;
+
+    if(length == 0 || length > self->count)
+        return false;
+
+    /* Let memchr find each place the first byte shows up. Then check the rest 
+    of the sequence from there, going around the end of the ring if needed. */
+    while(FindByteFrom(self, sequence[0], start, &match))
+    {
+        if(match > self->count - length)
+            break; // Not enough bytes left for the whole sequence
+
+        uint16_t i = 1;
+        while(i < length && ByteAtOffset(self, match + i) == sequence[i])
+            i++;
+
+        if(i == length)
+        {
+            *offset = match;
+            return true;
+        }
+        start = match + 1;
+    }
+    return false;
+}
+
+// *****************************************************************************
+
+uint16_t Buffer_ReadUntil(Buffer *self, uint8_t delimiter, uint8_t *array, uint16_t maxLength)
+{
+    uint16_t offset;
+
+    /* Only take the frame out once the delimiter has arrived and the whole 
+    frame will fit in the array. Otherwise leave everything where it is. */
+    if(!FindByteFrom(self, delimiter, 0, &offset) || offset >= maxLength)
+        return 0;
+
+    return Buffer_ReadArray(self, array, offset + 1);
+}
+
+// *****************************************************************************
+
+void Buffer_GetStats(Buffer *self, BufferStats *snapshot)
+{
+#if BUFFER_ENABLE_STATS
+    *snapshot = self->private.stats;
+#else
+    (void)self;
+    memset(snapshot, 0, sizeof(BufferStats));
+#endif
+}
+
+// *****************************************************************************
+
+void Buffer_ResetStats(Buffer *self)
+{
+#if BUFFER_ENABLE_STATS
+    memset(&self->private.stats, 0, sizeof(BufferStats));
+    self->private.stats.highWaterMark = self->count;
+#else
+    (void)self;
+#endif
+}
+
+// *****************************************************************************
+
+static inline void RecordWrite(Buffer *self, uint16_t numBytesIn, uint16_t numBytesDropped)
+{
+#if BUFFER_ENABLE_STATS
+    BufferStats *stats = &self->private.stats;
+
+    stats->bytesIn += numBytesIn;
+
+    if(numBytesDropped > 0)
+    {
+        stats->overflowCount++;
+        stats->bytesDropped += numBytesDropped;
+    }
+
+    if(self->count > stats->highWaterMark)
+        stats->highWaterMark = self->count;
+
+    /* Sort the count after each write into one of the bins. Bin 0 is nearly 
+    empty and the last bin is nearly full. */
+    uint16_t bin = ((uint32_t)self->count * BUFFER_STATS_NUM_BINS) / self->private.size;
+    stats->histogram[bin]++;
+#else
+    (void)self;
+    (void)numBytesIn;
+    (void)numBytesDropped;
+#endif
+}
+
+// *****************************************************************************
+
+static inline void RecordRead(Buffer *self, uint16_t numBytesOut)
+{
+#if BUFFER_ENABLE_STATS
+    self->private.stats.bytesOut += numBytesOut;
+#else
+    (void)self;
+    (void)numBytesOut;
+#endif
+}
+
+// *****************************************************************************
+
+static bool FindByteFrom(Buffer *self, uint8_t value, uint16_t start, uint16_t *offset)
+{
+    /* The data is in at most two pieces. The first runs from the tail to the 
+    end of the array, the second from the start of the array to the head. */
+    uint16_t count = self->count;
+    uint16_t tail = self->private.tail;
+    uint16_t firstPart = self->private.size - tail;
+    const uint8_t *found;
+
+    if(start >= count)
+        return false;
+
+    if(firstPart > count)
+        firstPart = count;
+
+    if(start < firstPart)
+    {
+        found = memchr(&self->private.buffer[tail + start], value, firstPart - start);
+        if(found)
+        {
+            *offset = (uint16_t)(found - &self->private.buffer[tail]);
+            return true;
+        }
+        start = firstPart;
+    }
+
+    found = memchr(&self->private.buffer[start - firstPart], value, count - start);
+    if(found)
+    {
+        *offset = firstPart + (uint16_t)(found - &self->private.buffer[0]);
+        return true;
+    }
+    return false;
+}
+
+// *****************************************************************************
+
+static inline uint8_t ByteAtOffset(Buffer *self, uint16_t offset)
+{
+    uint16_t index = self->private.tail + offset;
+    
+    if(index >= self->private.size)
+        index -= self->private.size;
+
+    return self->private.buffer[index];
+}
+
+// *****************************************************************************
+
+static uint16_t CopyOut(Buffer *self, uint8_t *array, uint16_t length)
+{
+    /* Copy up to length bytes starting at the tail without moving it. The 
+    copy is split at the end of the array. At most two memcpy's. */
+    uint16_t numRead = (length < self->count) ? length : self->count;
+    uint16_t tail = self->private.tail;
+    uint16_t firstPart = self->private.size - tail;
+
+    if(firstPart > numRead)
+        firstPart = numRead;
+
+    memcpy(array, &self->private.buffer[tail], firstPart);
+    memcpy(array + firstPart, &self->private.buffer[0], numRead - firstPart);
+    return numRead;
+}
+
 /*
  End of File
  */
\ No newline at end of file
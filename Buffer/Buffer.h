@@ -8,6 +8,10 @@
  * @date 4/1/19    Original creation
  * @date 10/5/21   Updated documention
  * @date 2/21/22   Added doxygen
+ * @date 10/16/26  Added array functions
+ * @date 10/16/26  Added region functions for zero-copy access
+ * @date 10/16/26  Added search functions
+ * @date 10/16/26  Added optional statistics
  * 
  * @details
  *      A basic 8-bit ring buffer. To create a buffer, the minimum you will 
@@ -22,6 +26,31 @@
  * be overwritten when placing data in the buffer. The default setting is 
  * false. 
  * 
+ * If you are moving whole frames of data in or out, use the array functions
+ * instead of calling the byte functions in a loop. They split the copy at the 
+ * end of the ring into at most two memcpy's instead of checking for the wrap 
+ * on every byte.
+ * 
+ * If you want a DMA or a parser to work directly on the buffer's array, there
+ * are region functions. Buffer_GetWriteRegion gives you a pointer to the 
+ * largest contiguous block of free space. Let your DMA fill it, then call 
+ * Buffer_CommitWrite with the number of bytes it wrote. Buffer_GetReadRegion 
+ * and Buffer_ReleaseRead do the same thing for reading. Because the ring 
+ * wraps, a region is never longer than the distance to the end of the array. 
+ * If you need more, call the function again after you commit or release.
+ * 
+ * For line or frame based protocols, there are search functions that look for 
+ * a delimiter or a sync pattern without removing anything from the buffer. 
+ * Buffer_ReadUntil only takes a frame out once the whole thing has arrived, 
+ * so you don't have to pull bytes out one at a time to look for the end.
+ * 
+ * If you aren't sure how big to make a buffer, set BUFFER_ENABLE_STATS to 1 
+ * in your compiler settings. Each buffer will keep track of its high water 
+ * mark, how many bytes went in and out, how many times it overflowed, how 
+ * many bytes were lost, and a rough histogram of how full it was after each 
+ * write. Call Buffer_GetStats to get a copy of them. It's off by default, 
+ * because it adds RAM to every buffer and a few instructions to every write.
+ * 
  * There is a buffer overflow callback function. The function you create for 
  * the callback must follow the prototype listed in Buffer.h. If overflow is 
  * about to happen and you have overwrite disabled, you will receive a callback 
@@ -46,12 +75,45 @@
 
 // ***** Defines ***************************************************************
 
+/* Set to 1 (here or with -DBUFFER_ENABLE_STATS=1) to keep statistics */
+#ifndef BUFFER_ENABLE_STATS
+#define BUFFER_ENABLE_STATS     0
+#endif
+
+/* Number of bins in the occupancy histogram */
+#define BUFFER_STATS_NUM_BINS   8
 
 // ***** Global Variables ******************************************************
 
 /* overflow callback function. Make your function pointer follow this format */
 typedef void (*BufferOverflowCallbackFunc)(void);
 
+typedef struct BufferStatsTag
+{
+    uint16_t highWaterMark;
+    uint32_t bytesIn;
+    uint32_t bytesOut;
+    uint32_t overflowCount;
+    uint32_t bytesDropped;
+    uint32_t histogram[BUFFER_STATS_NUM_BINS];
+} BufferStats;
+
+/**
+ * highWaterMark  the most bytes that were ever in the buffer at once
+ * 
+ * bytesIn  number of bytes put into the buffer
+ * 
+ * bytesOut  number of bytes taken out of the buffer by reads or a flush
+ * 
+ * overflowCount  number of writes that found the buffer full
+ * 
+ * bytesDropped  number of bytes lost to overflows. With overwrite enabled,
+ *               this counts the old bytes that were overwritten
+ * 
+ * histogram  after each write, one of the bins is incremented based on how 
+ *            full the buffer is. Bin 0 is the emptiest.
+ */
+
 typedef struct Buffer
 {
     uint8_t count;
@@ -65,6 +127,9 @@ typedef struct Buffer
         uint16_t head;
         uint16_t tail;
         BufferOverflowCallbackFunc bufferOverflowCallbackFunc;
+#if BUFFER_ENABLE_STATS
+        BufferStats stats;
+#endif
     } private;
 } Buffer;
 
@@ -223,5 +288,179 @@ bool Buffer_DidOverflow(Buffer *self);
  */
 void Buffer_SetOverflowCallback(Buffer *self, BufferOverflowCallbackFunc Function);
 
+/***************************************************************************//**
+ * @brief Put an array of bytes into the buffer then update the head.
+ * 
+ * If there isn't enough room and overwrite is disabled, as many bytes as will
+ * fit are written, then the overflow flag is set and the overflow callback is 
+ * called. If overwrite is enabled, all of the bytes are written and the 
+ * oldest data in the buffer is thrown away to make room. If the array is 
+ * larger than the buffer, only the newest bytes are kept.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param array  pointer to the bytes to store in the buffer
+ * 
+ * @param length  number of bytes to store
+ * 
+ * @return uint16_t  number of bytes written
+ */
+uint16_t Buffer_WriteArray(Buffer *self, const uint8_t *array, uint16_t length);
+
+/***************************************************************************//**
+ * @brief Read an array of bytes from the buffer then update the tail.
+ * 
+ * Reads up to length bytes. If there are fewer bytes in the buffer, you get 
+ * whatever is there.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param array  pointer to where the bytes will be copied
+ * 
+ * @param length  the maximum number of bytes to read
+ * 
+ * @return uint16_t  number of bytes read
+ */
+uint16_t Buffer_ReadArray(Buffer *self, uint8_t *array, uint16_t length);
+
+/***************************************************************************//**
+ * @brief Read an array of bytes from the buffer but don't update the tail.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param array  pointer to where the bytes will be copied
+ * 
+ * @param length  the maximum number of bytes to read
+ * 
+ * @return uint16_t  number of bytes copied
+ */
+uint16_t Buffer_PeekArray(Buffer *self, uint8_t *array, uint16_t length);
+
+/***************************************************************************//**
+ * @brief Get the largest contiguous block of free space in the buffer
+ * 
+ * Use this to let a DMA or a driver write straight into the buffer's array. 
+ * Nothing is changed until you call Buffer_CommitWrite. Length will be zero 
+ * if the buffer is full.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param region  returns a pointer to the start of the free space
+ * 
+ * @param length  returns the number of bytes you may write there
+ */
+void Buffer_GetWriteRegion(Buffer *self, uint8_t **region, uint16_t *length);
+
+/***************************************************************************//**
+ * @brief Add bytes written into the write region to the buffer
+ * 
+ * Moves the head up by the number of bytes. It can't be more than the amount 
+ * of free space in the buffer.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param numBytes  the number of bytes that were written into the region
+ */
+void Buffer_CommitWrite(Buffer *self, uint16_t numBytes);
+
+/***************************************************************************//**
+ * @brief Get the largest contiguous block of data in the buffer
+ * 
+ * Use this to parse or transmit straight out of the buffer's array. Nothing 
+ * is removed until you call Buffer_ReleaseRead. Length will be zero if the 
+ * buffer is empty.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param region  returns a pointer to the oldest byte in the buffer
+ * 
+ * @param length  returns the number of bytes you may read from there
+ */
+void Buffer_GetReadRegion(Buffer *self, uint8_t **region, uint16_t *length);
+
+/***************************************************************************//**
+ * @brief Remove bytes from the buffer after you are done with them
+ * 
+ * Moves the tail up by the number of bytes. It can't be more than the count.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param numBytes  the number of bytes to remove
+ */
+void Buffer_ReleaseRead(Buffer *self, uint16_t numBytes);
+
+/***************************************************************************//**
+ * @brief Find the first occurrence of a byte without removing anything
+ * 
+ * The offset is counted from the oldest byte in the buffer, so an offset of 
+ * zero is the byte that Buffer_Peek would return.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param value  the byte to look for
+ * 
+ * @param offset  returns the position of the byte, if found
+ * 
+ * @return true if the byte was found
+ */
+bool Buffer_FindByte(Buffer *self, uint8_t value, uint16_t *offset);
+
+/***************************************************************************//**
+ * @brief Find the first occurrence of a sequence of bytes
+ * 
+ * Nothing is removed from the buffer. The sequence may go around the end of 
+ * the ring.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param sequence  pointer to the bytes to look for
+ * 
+ * @param length  the number of bytes in the sequence
+ * 
+ * @param offset  returns the position of the first byte of the sequence
+ * 
+ * @return true if the sequence was found
+ */
+bool Buffer_FindSequence(Buffer *self, const uint8_t *sequence, uint16_t length, uint16_t *offset);
+
+/***************************************************************************//**
+ * @brief Read everything up to and including a delimiter
+ * 
+ * If the delimiter is not in the buffer yet, nothing is read and the function 
+ * returns zero. The same is true if the frame is longer than maxLength. In 
+ * that case you may want to check Buffer_IsFull and flush the buffer.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param delimiter  the byte that marks the end of a frame, like '\n'
+ * 
+ * @param array  pointer to where the frame will be copied
+ * 
+ * @param maxLength  the size of said array
+ * 
+ * @return uint16_t  number of bytes read including the delimiter
+ */
+uint16_t Buffer_ReadUntil(Buffer *self, uint8_t delimiter, uint8_t *array, uint16_t maxLength);
+
+/***************************************************************************//**
+ * @brief Get a copy of the buffer's statistics
+ * 
+ * If BUFFER_ENABLE_STATS is 0, the statistics will all be zero.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ * 
+ * @param snapshot  pointer to where the statistics will be copied
+ */
+void Buffer_GetStats(Buffer *self, BufferStats *snapshot);
+
+/***************************************************************************//**
+ * @brief Clear the buffer's statistics
+ * 
+ * The high water mark starts over at the current count.
+ * 
+ * @param self  pointer to the Buffer that you are using
+ */
+void Buffer_ResetStats(Buffer *self);
+
 #endif  /* BUFFER_H */
 
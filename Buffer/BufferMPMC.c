@@ -0,0 +1,201 @@
+/***************************************************************************//**
+ * @brief Bounded Multiple Producer Multiple Consumer Queue
+ * 
+ * @file BufferMPMC.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See BufferMPMC.h. For a slot at position "pos" (the free running head
+ * or tail count), the sequence number means:
+ * 
+ *      sequence == pos          the slot is empty and ready for a producer
+ *      sequence == pos + 1      the slot is full and ready for a consumer
+ *      sequence == pos + size   the slot is empty again for the next lap
+ * 
+ * Everything is done with unsigned 32-bit math and the difference is looked
+ * at as a signed number, so it all still works after the counts roll over.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "BufferMPMC.h"
+#include <string.h>
+
+// ***** Defines ***************************************************************
+
+#define BUFFER_MPMC_MAX_SLOTS   (1UL << 31)
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+
+// *****************************************************************************
+
+bool BufferMPMC_Init(BufferMPMC *self, void *recordArray, BufferMPMCSequence *sequenceArray, uint32_t numSlots, size_t recordSize)
+{
+    if(recordArray == NULL || sequenceArray == NULL || recordSize == 0 ||
+        numSlots < 2 || numSlots > BUFFER_MPMC_MAX_SLOTS || (numSlots & (numSlots - 1)) != 0)
+    {
+        return false;
+    }
+
+    self->private.records = recordArray;
+    self->private.sequence = sequenceArray;
+    self->private.mask = numSlots - 1;
+    self->private.recordSize = recordSize;
+    self->private.bufferOverflowCallbackFunc = NULL;
+    atomic_init(&self->private.overflow, false);
+    atomic_init(&self->private.head, 0);
+    atomic_init(&self->private.tail, 0);
+
+    /* Every slot starts out empty for the first lap */
+    for(uint32_t i = 0; i < numSlots; i++)
+        atomic_init(&sequenceArray[i], i);
+
+    return true;
+}
+
+// *****************************************************************************
+
+bool BufferMPMC_Write(BufferMPMC *self, const void *record)
+{
+    uint32_t pos = atomic_load_explicit(&self->private.head, memory_order_relaxed);
+    BufferMPMCSequence *slot;
+
+    while(1)
+    {
+        slot = &self->private.sequence[pos & self->private.mask];
+        uint32_t seq = atomic_load_explicit(slot, memory_order_acquire);
+        int32_t dif = (int32_t)(seq - pos);
+
+        if(dif == 0)
+        {
+            /* The slot is empty. Try to claim it. If another producer beat us
+            to it, pos is reloaded with the new head and we try again. */
+            if(atomic_compare_exchange_weak_explicit(&self->private.head, &pos, pos + 1,
+                memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(dif < 0)
+        {
+            /* The slot still has last lap's record in it. The queue is full */
+            atomic_store_explicit(&self->private.overflow, true, memory_order_relaxed);
+
+            if(self->private.bufferOverflowCallbackFunc)
+            {
+                self->private.bufferOverflowCallbackFunc();
+            }
+            return false;
+        }
+        else
+        {
+            /* Another producer already took this slot. Catch up. */
+            pos = atomic_load_explicit(&self->private.head, memory_order_relaxed);
+        }
+    }
+
+    memcpy(&self->private.records[(size_t)(pos & self->private.mask) * self->private.recordSize],
+        record, self->private.recordSize);
+    atomic_store_explicit(slot, pos + 1, memory_order_release);
+    return true;
+}
+
+// *****************************************************************************
+
+bool BufferMPMC_Read(BufferMPMC *self, void *record)
+{
+    uint32_t pos = atomic_load_explicit(&self->private.tail, memory_order_relaxed);
+    BufferMPMCSequence *slot;
+
+    while(1)
+    {
+        slot = &self->private.sequence[pos & self->private.mask];
+        uint32_t seq = atomic_load_explicit(slot, memory_order_acquire);
+        int32_t dif = (int32_t)(seq - (pos + 1));
+
+        if(dif == 0)
+        {
+            if(atomic_compare_exchange_weak_explicit(&self->private.tail, &pos, pos + 1,
+                memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(dif < 0)
+        {
+            // Nothing has been written to this slot yet. The queue is empty
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&self->private.tail, memory_order_relaxed);
+        }
+    }
+
+    memcpy(record, &self->private.records[(size_t)(pos & self->private.mask) * self->private.recordSize],
+        self->private.recordSize);
+
+    /* Mark the slot empty for the producers on the next lap */
+    atomic_store_explicit(slot, pos + self->private.mask + 1, memory_order_release);
+    return true;
+}
+
+// *****************************************************************************
+
+uint32_t BufferMPMC_GetCount(BufferMPMC *self)
+{
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_acquire);
+    int32_t count = (int32_t)(head - tail);
+
+    /* The two loads aren't taken at the same instant, so keep it in range */
+    if(count < 0)
+        count = 0;
+    else if((uint32_t)count > self->private.mask + 1)
+        count = self->private.mask + 1;
+
+    return (uint32_t)count;
+}
+
+// *****************************************************************************
+
+bool BufferMPMC_IsNotEmpty(BufferMPMC *self)
+{
+    if(BufferMPMC_GetCount(self) != 0)
+        return true;
+    else
+        return false;
+}
+
+// *****************************************************************************
+
+bool BufferMPMC_DidOverflow(BufferMPMC *self)
+{
+    // Automatically clear the flag
+    return atomic_exchange_explicit(&self->private.overflow, false, memory_order_relaxed);
+}
+
+// *****************************************************************************
+
+void BufferMPMC_SetOverflowCallback(BufferMPMC *self, BufferMPMCOverflowCallbackFunc Function)
+{
+    self->private.bufferOverflowCallbackFunc = Function;
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,210 @@
+/***************************************************************************//**
+ * @brief Bounded Multiple Producer Multiple Consumer Queue Header
+ * 
+ * @file BufferMPMC.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      A fixed size queue of fixed size records that any number of threads
+ * can write to and read from at the same time, without a mutex. It is meant
+ * for host machines where several worker threads push records (telemetry,
+ * log messages, etc.) into one queue.
+ * 
+ * This is Dmitry Vyukov's bounded MPMC queue. Every slot in the queue has its
+ * own sequence number next to it. A producer claims a slot by bumping the head
+ * with a compare and swap, but only if the slot's sequence number says the
+ * slot is empty for this lap around the ring. It copies its record in, then
+ * bumps the slot's sequence number to say "full". A consumer does the same
+ * thing with the tail, waits for "full", copies the record out, and then
+ * sets the sequence number to "empty" for the next lap. Each thread only
+ * fights over the head or the tail for a single compare and swap. The copying
+ * happens in parallel.
+ * 
+ * Just like my other buffers, you give it the memory. There is no malloc. You
+ * need an array for the records and an array of sequence numbers, both with
+ * the same number of slots. The number of slots must be a power of two. If
+ * the queue is full, the record is dropped, the overflow flag is set, and the
+ * overflow callback is called.
+ * 
+ * Requires a compiler with C11 <stdatomic.h> support.
+ * 
+ * @section example_code Example Code
+ * 
+ *      typedef struct { uint32_t id; float value; } Telemetry;
+ *      Telemetry records[1024];
+ *      BufferMPMCSequence sequence[1024];
+ *      BufferMPMC queue;
+ * 
+ *      BufferMPMC_Init(&queue, records, sequence, 1024, sizeof(Telemetry));
+ * 
+ *      // Any thread
+ *      Telemetry t = {.id = 5, .value = 1.0f};
+ *      BufferMPMC_Write(&queue, &t);
+ * 
+ *      // Any other thread
+ *      if(BufferMPMC_Read(&queue, &t))
+ *      {
+ *          // do something
+ *      }
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef BUFFER_MPMC_H
+#define BUFFER_MPMC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// ***** Defines ***************************************************************
+
+/* The head and tail are kept on separate cache lines so that producers and
+consumers don't slow each other down. */
+#define BUFFER_MPMC_CACHE_LINE  64
+
+// ***** Global Variables ******************************************************
+
+/* Declare an array of these with the same number of slots as your records */
+typedef _Atomic uint32_t BufferMPMCSequence;
+
+/* overflow callback function. Make your function pointer follow this format */
+typedef void (*BufferMPMCOverflowCallbackFunc)(void);
+
+typedef struct BufferMPMCTag
+{
+    struct
+    {
+        uint8_t *records;
+        BufferMPMCSequence *sequence;
+        uint32_t mask;
+        size_t recordSize;
+        BufferMPMCOverflowCallbackFunc bufferOverflowCallbackFunc;
+        atomic_bool overflow;
+        _Alignas(BUFFER_MPMC_CACHE_LINE) _Atomic uint32_t head;
+        _Alignas(BUFFER_MPMC_CACHE_LINE) _Atomic uint32_t tail;
+    } private;
+} BufferMPMC;
+
+/**
+ * The variables below should be treated as private. You should only access
+ * them with the use of a function.
+ * 
+ * records  pointer to the array of records
+ * 
+ * sequence  pointer to the array of sequence numbers, one per slot
+ * 
+ * mask  number of slots - 1. Used in place of modulo division
+ * 
+ * recordSize  the size of each record in bytes
+ * 
+ * overflow  true if a record was dropped because the queue was full
+ * 
+ * head  free running count of slots claimed by producers
+ * 
+ * tail  free running count of slots claimed by consumers
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initializes a BufferMPMC object.
+ * 
+ * Call this before any of the threads start using the queue. The number of
+ * slots must be a power of two from 2 to 2^31.
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @param recordArray  pointer to the array of records
+ * 
+ * @param sequenceArray  pointer to an array of sequence numbers
+ * 
+ * @param numSlots  the number of slots in both arrays
+ * 
+ * @param recordSize  the size of each record in bytes
+ * 
+ * @return true if the queue was initialized
+ */
+bool BufferMPMC_Init(BufferMPMC *self, void *recordArray, BufferMPMCSequence *sequenceArray, uint32_t numSlots, size_t recordSize);
+
+/***************************************************************************//**
+ * @brief Copy a record into the queue. Safe to call from any thread.
+ * 
+ * If the queue is full, the record is dropped, the overflow flag is set, and
+ * the overflow callback is called from the calling thread.
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @param record  pointer to the record to store
+ * 
+ * @return true if the record was stored
+ */
+bool BufferMPMC_Write(BufferMPMC *self, const void *record);
+
+/***************************************************************************//**
+ * @brief Copy the oldest record out of the queue. Safe to call from any thread.
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @param record  pointer to where the record will be copied
+ * 
+ * @return true if there was a record to read
+ */
+bool BufferMPMC_Read(BufferMPMC *self, void *record);
+
+/***************************************************************************//**
+ * @brief Get the number of records in the queue
+ * 
+ * With other threads running, this is only a snapshot.
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @return uint32_t  number of records in the queue
+ */
+uint32_t BufferMPMC_GetCount(BufferMPMC *self);
+
+/***************************************************************************//**
+ * @brief Is there something in the queue
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @return true if the queue is not empty
+ */
+bool BufferMPMC_IsNotEmpty(BufferMPMC *self);
+
+/***************************************************************************//**
+ * @brief Check if the queue overflowed
+ * 
+ * The overflow flag is cleared when you call this function.
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @return true if the queue did overflow
+ */
+bool BufferMPMC_DidOverflow(BufferMPMC *self);
+
+/***************************************************************************//**
+ * @brief A function pointer that is called when the queue overflows
+ * 
+ * @param self  pointer to the BufferMPMC that you are using
+ * 
+ * @param Function  format: void SomeFunction(void)
+ */
+void BufferMPMC_SetOverflowCallback(BufferMPMC *self, BufferMPMCOverflowCallbackFunc Function);
+
+#endif  /* BUFFER_MPMC_H */
@@ -0,0 +1,173 @@
+/***************************************************************************//**
+ * @brief Lock-Free Single Producer Single Consumer Ring Buffer
+ * 
+ * @file BufferSPSC.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See BufferSPSC.h. The short version: the producer owns the head, the
+ * consumer owns the tail, and nobody shares a counter. Each side loads its
+ * own index with relaxed ordering (nobody else writes it), loads the other
+ * side's index with acquire ordering, and publishes its own index with
+ * release ordering.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "BufferSPSC.h"
+
+// ***** Defines ***************************************************************
+
+/* Same simple check as the regular Buffer to go around the ring buffer */
+#define CircularIncrement(i, size) ((i) == ((size) - 1) ? 0 : (i) + 1)
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+
+// *****************************************************************************
+
+void BufferSPSC_Init(BufferSPSC *self, uint8_t *arrayIn, uint32_t arrayInSize)
+{
+    self->private.buffer = arrayIn;
+    self->private.size = arrayInSize;
+    self->private.bufferOverflowCallbackFunc = 0;
+    atomic_init(&self->private.head, 0);
+    atomic_init(&self->private.tail, 0);
+    atomic_init(&self->private.overflow, false);
+}
+
+// *****************************************************************************
+
+bool BufferSPSC_WriteByte(BufferSPSC *self, uint8_t receivedByte)
+{
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_relaxed);
+    uint32_t tempHead = CircularIncrement(head, self->private.size);
+
+    if(tempHead == atomic_load_explicit(&self->private.tail, memory_order_acquire))
+    {
+        // There is no space in the buffer. Drop the byte.
+        atomic_store_explicit(&self->private.overflow, true, memory_order_relaxed);
+
+        if(self->private.bufferOverflowCallbackFunc)
+        {
+            self->private.bufferOverflowCallbackFunc();
+        }
+        return false;
+    }
+
+    /* Store the byte first, then publish the new head. The release makes sure
+    the consumer can't see the new head before it can see the byte. */
+    self->private.buffer[head] = receivedByte;
+    atomic_store_explicit(&self->private.head, tempHead, memory_order_release);
+    return true;
+}
+
+// *****************************************************************************
+
+uint8_t BufferSPSC_ReadByte(BufferSPSC *self)
+{
+    uint8_t dataToReturn = 0;
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_relaxed);
+
+    if(tail != atomic_load_explicit(&self->private.head, memory_order_acquire))
+    {
+        /* Read the byte first, then give the slot back to the producer */
+        dataToReturn = self->private.buffer[tail];
+        atomic_store_explicit(&self->private.tail,
+            CircularIncrement(tail, self->private.size), memory_order_release);
+    }
+    return dataToReturn;
+}
+
+// *****************************************************************************
+
+uint8_t BufferSPSC_Peek(BufferSPSC *self)
+{
+    uint8_t dataToReturn = 0;
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_relaxed);
+
+    if(tail != atomic_load_explicit(&self->private.head, memory_order_acquire))
+    {
+        dataToReturn = self->private.buffer[tail];
+    }
+    return dataToReturn;
+}
+
+// *****************************************************************************
+
+void BufferSPSC_Flush(BufferSPSC *self)
+{
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_acquire);
+    atomic_store_explicit(&self->private.tail, head, memory_order_release);
+}
+
+// *****************************************************************************
+
+uint32_t BufferSPSC_GetCount(BufferSPSC *self)
+{
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_acquire);
+
+    if(head >= tail)
+        return head - tail;
+    else
+        return self->private.size - tail + head;
+}
+
+// *****************************************************************************
+
+bool BufferSPSC_IsFull(BufferSPSC *self)
+{
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_acquire);
+
+    if(CircularIncrement(head, self->private.size) == tail)
+        return true;
+    else
+        return false;
+}
+
+// *****************************************************************************
+
+bool BufferSPSC_IsNotEmpty(BufferSPSC *self)
+{
+    uint32_t head = atomic_load_explicit(&self->private.head, memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&self->private.tail, memory_order_acquire);
+
+    if(head != tail)
+        return true;
+    else
+        return false;
+}
+
+// *****************************************************************************
+
+bool BufferSPSC_DidOverflow(BufferSPSC *self)
+{
+    // Automatically clear the flag
+    return atomic_exchange_explicit(&self->private.overflow, false, memory_order_relaxed);
+}
+
+// *****************************************************************************
+
+void BufferSPSC_SetOverflowCallback(BufferSPSC *self, BufferSPSCOverflowCallbackFunc Function)
+{
+    self->private.bufferOverflowCallbackFunc = Function;
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,226 @@
+/***************************************************************************//**
+ * @brief Lock-Free Single Producer Single Consumer Ring Buffer Header
+ * 
+ * @file BufferSPSC.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      A version of my basic 8-bit ring buffer that can be shared between
+ * exactly one producer and exactly one consumer without disabling interrupts.
+ * The producer could be an interrupt and the consumer could be your main loop,
+ * or they could be two threads on a host machine.
+ * 
+ * The regular Buffer keeps a count that both the read and write functions
+ * modify. If an interrupt fires in the middle of "count++" in the main loop,
+ * one of the changes is lost. This version gets rid of the count entirely.
+ * The producer is the only one allowed to move the head, and the consumer is
+ * the only one allowed to move the tail. The count is computed from the two
+ * whenever you ask for it. The head and tail use C11 atomics. When the
+ * producer stores the head it uses "release" ordering, which guarantees that
+ * the byte it wrote is visible before the new head is. The consumer loads the
+ * head with "acquire" ordering so that it never reads a byte before it has
+ * actually arrived. The tail works the same way in the other direction.
+ * 
+ * Because of this, there is no overwrite option. Overwriting data would
+ * require the producer to move the tail, which belongs to the consumer. If
+ * the buffer is full, the byte is dropped and the overflow flag is set.
+ * 
+ * This file requires a compiler with C11 <stdatomic.h> support, and a target
+ * where a 32-bit atomic load and store is lock-free. (Cortex-M, x86, etc.)
+ * If you are on a PIC16 or PIC18, use the regular Buffer and disable
+ * interrupts around it instead.
+ * 
+ * @section example_code Example Code
+ * 
+ *      uint8_t rxArray[64];
+ *      BufferSPSC rxBuffer;
+ *      BufferSPSC_Init(&rxBuffer, rxArray, sizeof(rxArray));
+ * 
+ *      // In your receive interrupt (producer)
+ *      BufferSPSC_WriteByte(&rxBuffer, UART_ReceiveByte());
+ * 
+ *      // In your main loop (consumer)
+ *      while(BufferSPSC_IsNotEmpty(&rxBuffer))
+ *          ParseByte(BufferSPSC_ReadByte(&rxBuffer));
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef BUFFER_SPSC_H
+#define BUFFER_SPSC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+/* overflow callback function. Make your function pointer follow this format */
+typedef void (*BufferSPSCOverflowCallbackFunc)(void);
+
+typedef struct BufferSPSCTag
+{
+    struct
+    {
+        uint8_t *buffer;
+        uint32_t size;
+        atomic_uint_fast32_t head;
+        atomic_uint_fast32_t tail;
+        atomic_bool overflow;
+        BufferSPSCOverflowCallbackFunc bufferOverflowCallbackFunc;
+    } private;
+} BufferSPSC;
+
+/**
+ * The variables below should be treated as private. You should only access
+ * them with the use of a function.
+ * 
+ * buffer  pointer to the array which will form your ring buffer
+ * 
+ * size  the size of your array. The buffer can hold size - 1 bytes.
+ * 
+ * head  index of the next byte to be written. Only the producer changes it.
+ * 
+ * tail  index of the next byte to be read. Only the consumer changes it.
+ * 
+ * overflow  true if the producer had to drop a byte. Set by the producer and
+ *           cleared by the consumer
+ * 
+ * bufferOverflowCallbackFunc  called from the producer's context when a byte
+ *                             is dropped
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initializes a BufferSPSC object.
+ * 
+ * Call this before the producer or the consumer start running. One slot of
+ * the array is always left empty to tell the difference between full and
+ * empty, so the buffer holds arrayInSize - 1 bytes.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @param arrayIn  pointer to the array that you are going to use
+ * 
+ * @param arrayInSize  the size of said array. Must be at least 2
+ */
+void BufferSPSC_Init(BufferSPSC *self, uint8_t *arrayIn, uint32_t arrayInSize);
+
+/***************************************************************************//**
+ * @brief Put a byte into the buffer then update the head. (Producer only)
+ * 
+ * If the buffer is full, the byte is dropped, the overflow flag is set, and
+ * the overflow callback is called.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @param receivedByte  the byte to store in the buffer
+ * 
+ * @return true if the byte was stored
+ */
+bool BufferSPSC_WriteByte(BufferSPSC *self, uint8_t receivedByte);
+
+/***************************************************************************//**
+ * @brief Read a byte from the buffer then update the tail. (Consumer only)
+ * 
+ * Returns zero if the buffer is empty. It is your responsibility to check if
+ * the buffer has data beforehand.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return uint8_t  byte read from the buffer. 0 if empty
+ */
+uint8_t BufferSPSC_ReadByte(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Read a byte from the buffer but don't update the tail. (Consumer only)
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return uint8_t  byte read from the buffer. 0 if empty
+ */
+uint8_t BufferSPSC_Peek(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Clear the buffer. (Consumer only)
+ * 
+ * Discards everything that has been written so far by moving the tail up to
+ * the head. Bytes that the producer writes during this call may or may not
+ * be discarded.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ */
+void BufferSPSC_Flush(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Get amount of data stored in the buffer
+ * 
+ * The result is a snapshot. From the consumer's side, the real count can only
+ * be larger. From the producer's side, it can only be smaller.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return uint32_t  number of bytes in the buffer
+ */
+uint32_t BufferSPSC_GetCount(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Is the buffer full
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return true if buffer is full
+ */
+bool BufferSPSC_IsFull(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Is there something in the buffer
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return true if buffer is not empty
+ */
+bool BufferSPSC_IsNotEmpty(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief Check if the buffer overflowed
+ * 
+ * The overflow flag is cleared when you call this function.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @return true if buffer did overflow
+ */
+bool BufferSPSC_DidOverflow(BufferSPSC *self);
+
+/***************************************************************************//**
+ * @brief A function pointer that is called when the buffer overflows
+ * 
+ * The function is called from the producer's context, so if your producer is
+ * an interrupt, keep it short.
+ * 
+ * @param self  pointer to the BufferSPSC that you are using
+ * 
+ * @param Function  format: void SomeFunction(void)
+ */
+void BufferSPSC_SetOverflowCallback(BufferSPSC *self, BufferSPSCOverflowCallbackFunc Function);
+
+#endif  /* BUFFER_SPSC_H */
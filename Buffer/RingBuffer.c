@@ -0,0 +1,384 @@
+/***************************************************************************//**
+ * @brief Generic Power of Two Ring Buffer
+ * 
+ * @file RingBuffer.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * @date 10/16/26  Added mirrored mode
+ * 
+ * @details
+ *      See RingBuffer.h. The head and tail are never wrapped. They count up
+ * forever and roll over at 2^32. Since the size is a power of two, it divides
+ * 2^32 evenly, so "head & mask" is still the right index after the roll over.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "RingBuffer.h"
+#include <string.h>
+
+// ***** Defines ***************************************************************
+
+#define RING_BUFFER_MAX_SIZE    (1UL << 31)
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+static inline void CopyElement(void *dest, const void *src, size_t size);
+static void CopyIn(RingBuffer *self, uint32_t position, const uint8_t *array, uint32_t numElements);
+static void CopyOut(RingBuffer *self, uint32_t position, uint8_t *array, uint32_t numElements);
+
+// *****************************************************************************
+
+bool RingBuffer_Init(RingBuffer *self, void *arrayIn, uint32_t numElements, size_t elementSize)
+{
+    return RingBuffer_InitWithOverwrite(self, arrayIn, numElements, elementSize, false);
+}
+
+// *****************************************************************************
+
+bool RingBuffer_InitWithOverwrite(RingBuffer *self, void *arrayIn, uint32_t numElements, size_t elementSize, bool overwrite)
+{
+    /* A power of two has exactly one bit set */
+    if(arrayIn == NULL || elementSize == 0 || numElements == 0 ||
+        numElements > RING_BUFFER_MAX_SIZE || (numElements & (numElements - 1)) != 0)
+    {
+        return false;
+    }
+
+    self->private.buffer = arrayIn;
+    self->private.size = numElements;
+    self->private.mask = numElements - 1;
+    self->private.elementSize = elementSize;
+    self->private.head = 0;
+    self->private.tail = 0;
+    self->private.isMirrored = false;
+    self->private.bufferOverflowCallbackFunc = NULL;
+    self->enableOverwrite = overwrite;
+    self->overflow = false;
+    return true;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_InitMirrored(RingBuffer *self, void *mirroredArray, uint32_t numElements, size_t elementSize)
+{
+    if(!RingBuffer_InitWithOverwrite(self, mirroredArray, numElements, elementSize, false))
+        return false;
+
+    self->private.isMirrored = true;
+    return true;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_Write(RingBuffer *self, const void *element)
+{
+    if(self->private.head - self->private.tail == self->private.size)
+    {
+        self->overflow = true;
+
+        if(!self->enableOverwrite)
+        {
+            // There is no space in the buffer and overwrite is disabled
+            if(self->private.bufferOverflowCallbackFunc)
+            {
+                self->private.bufferOverflowCallbackFunc();
+            }
+            return false;
+        }
+        // Overwrite is enabled. Move the tail up one
+        self->private.tail++;
+    }
+
+    uint32_t index = self->private.head & self->private.mask;
+    CopyElement(&self->private.buffer[index * self->private.elementSize], element, self->private.elementSize);
+    self->private.head++;
+    return true;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_Read(RingBuffer *self, void *element)
+{
+    if(self->private.head == self->private.tail)
+        return false;
+
+    uint32_t index = self->private.tail & self->private.mask;
+    CopyElement(element, &self->private.buffer[index * self->private.elementSize], self->private.elementSize);
+    self->private.tail++;
+    self->overflow = false;
+    return true;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_Peek(RingBuffer *self, void *element)
+{
+    if(self->private.head == self->private.tail)
+        return false;
+
+    uint32_t index = self->private.tail & self->private.mask;
+    CopyElement(element, &self->private.buffer[index * self->private.elementSize], self->private.elementSize);
+    return true;
+}
+
+// *****************************************************************************
+
+uint32_t RingBuffer_WriteArray(RingBuffer *self, const void *array, uint32_t numElements)
+{
+    const uint8_t *arrayPtr = array;
+    uint32_t space = self->private.size - (self->private.head - self->private.tail);
+
+    if(numElements > space)
+    {
+        self->overflow = true;
+
+        if(self->enableOverwrite)
+        {
+            /* Skip the elements that would just be overwritten anyways, then
+            move the tail up to make room. */
+            if(numElements > self->private.size)
+            {
+                arrayPtr += (size_t)(numElements - self->private.size) * self->private.elementSize;
+                numElements = self->private.size;
+            }
+            self->private.tail += numElements - space;
+            space = numElements;
+        }
+        else
+        {
+            numElements = space;
+
+            if(self->private.bufferOverflowCallbackFunc)
+            {
+                self->private.bufferOverflowCallbackFunc();
+            }
+        }
+    }
+
+    CopyIn(self, self->private.head, arrayPtr, numElements);
+    self->private.head += numElements;
+    return numElements;
+}
+
+// *****************************************************************************
+
+uint32_t RingBuffer_ReadArray(RingBuffer *self, void *array, uint32_t numElements)
+{
+    uint32_t count = self->private.head - self->private.tail;
+
+    if(numElements > count)
+        numElements = count;
+
+    if(numElements > 0)
+    {
+        CopyOut(self, self->private.tail, array, numElements);
+        self->private.tail += numElements;
+        self->overflow = false;
+    }
+    return numElements;
+}
+
+// *****************************************************************************
+
+uint32_t RingBuffer_PeekArray(RingBuffer *self, void *array, uint32_t numElements)
+{
+    uint32_t count = self->private.head - self->private.tail;
+
+    if(numElements > count)
+        numElements = count;
+
+    CopyOut(self, self->private.tail, array, numElements);
+    return numElements;
+}
+
+// *****************************************************************************
+
+void RingBuffer_GetWriteRegion(RingBuffer *self, void **region, uint32_t *numElements)
+{
+    uint32_t index = self->private.head & self->private.mask;
+    uint32_t space = self->private.size - (self->private.head - self->private.tail);
+    uint32_t untilEnd = self->private.size - index;
+
+    /* If the array is mirrored, running off the end is fine */
+    if(self->private.isMirrored)
+        untilEnd = self->private.size;
+
+    *numElements = (space < untilEnd) ? space : untilEnd;
+    *region = &self->private.buffer[index * self->private.elementSize];
+}
+
+// *****************************************************************************
+
+void RingBuffer_CommitWrite(RingBuffer *self, uint32_t numElements)
+{
+    uint32_t space = self->private.size - (self->private.head - self->private.tail);
+
+    if(numElements > space)
+        numElements = space;
+
+    self->private.head += numElements;
+}
+
+// *****************************************************************************
+
+void RingBuffer_GetReadRegion(RingBuffer *self, void **region, uint32_t *numElements)
+{
+    uint32_t index = self->private.tail & self->private.mask;
+    uint32_t count = self->private.head - self->private.tail;
+    uint32_t untilEnd = self->private.size - index;
+
+    if(self->private.isMirrored)
+        untilEnd = self->private.size;
+
+    *numElements = (count < untilEnd) ? count : untilEnd;
+    *region = &self->private.buffer[index * self->private.elementSize];
+}
+
+// *****************************************************************************
+
+void RingBuffer_ReleaseRead(RingBuffer *self, uint32_t numElements)
+{
+    uint32_t count = self->private.head - self->private.tail;
+
+    if(numElements > count)
+        numElements = count;
+
+    if(numElements > 0)
+    {
+        self->private.tail += numElements;
+        self->overflow = false;
+    }
+}
+
+// *****************************************************************************
+
+void RingBuffer_Flush(RingBuffer *self)
+{
+    self->private.tail = self->private.head;
+}
+
+// *****************************************************************************
+
+uint32_t RingBuffer_GetCount(RingBuffer *self)
+{
+    /* Unsigned subtraction still works after the head rolls over */
+    return self->private.head - self->private.tail;
+}
+
+// *****************************************************************************
+
+uint32_t RingBuffer_GetSize(RingBuffer *self)
+{
+    return self->private.size;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_IsFull(RingBuffer *self)
+{
+    if(self->private.head - self->private.tail == self->private.size)
+        return true;
+    else
+        return false;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_IsNotEmpty(RingBuffer *self)
+{
+    if(self->private.head != self->private.tail)
+        return true;
+    else
+        return false;
+}
+
+// *****************************************************************************
+
+bool RingBuffer_DidOverflow(RingBuffer *self)
+{
+    // Automatically clear the flag
+    bool temp = self->overflow;
+    self->overflow = false;
+    return temp;
+}
+
+// *****************************************************************************
+
+void RingBuffer_SetOverflowCallback(RingBuffer *self, RingBufferOverflowCallbackFunc Function)
+{
+    self->private.bufferOverflowCallbackFunc = Function;
+}
+
+// *****************************************************************************
+
+static inline void CopyElement(void *dest, const void *src, size_t size)
+{
+    /* Give the compiler a constant size for the common cases so that it can
+    turn the memcpy into a single load and store. */
+    switch(size)
+    {
+        case 1:
+            memcpy(dest, src, 1);
+            break;
+        case 2:
+            memcpy(dest, src, 2);
+            break;
+        case 4:
+            memcpy(dest, src, 4);
+            break;
+        case 8:
+            memcpy(dest, src, 8);
+            break;
+        default:
+            memcpy(dest, src, size);
+            break;
+    }
+}
+
+// *****************************************************************************
+
+static void CopyIn(RingBuffer *self, uint32_t position, const uint8_t *array, uint32_t numElements)
+{
+    /* The copy is split at the end of the array. At most two memcpy's. */
+    uint32_t index = position & self->private.mask;
+    uint32_t firstPart = self->private.size - index;
+    size_t elementSize = self->private.elementSize;
+
+    if(firstPart > numElements || self->private.isMirrored)
+        firstPart = numElements;
+
+    memcpy(&self->private.buffer[index * elementSize], array, firstPart * elementSize);
+    memcpy(&self->private.buffer[0], array + firstPart * elementSize, (numElements - firstPart) * elementSize);
+}
+
+// *****************************************************************************
+
+static void CopyOut(RingBuffer *self, uint32_t position, uint8_t *array, uint32_t numElements)
+{
+    uint32_t index = position & self->private.mask;
+    uint32_t firstPart = self->private.size - index;
+    size_t elementSize = self->private.elementSize;
+
+    if(firstPart > numElements || self->private.isMirrored)
+        firstPart = numElements;
+
+    memcpy(array, &self->private.buffer[index * elementSize], firstPart * elementSize);
+    memcpy(array + firstPart * elementSize, &self->private.buffer[0], (numElements - firstPart) * elementSize);
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,360 @@
+/***************************************************************************//**
+ * @brief Generic Power of Two Ring Buffer Header
+ * 
+ * @file RingBuffer.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * @date 10/16/26  Added mirrored mode
+ * 
+ * @details
+ *      A bigger brother to my basic 8-bit ring buffer. The regular Buffer
+ * holds at most 255 bytes and every element is a byte. This one can hold up
+ * to 2^31 elements and each element can be any size you want, like a
+ * uint16_t ADC sample or an 8 byte message struct.
+ * 
+ * The catch is that the number of elements must be a power of two. In
+ * exchange, the ring buffer never has to check for the end of the array.
+ * The head and tail are free running 32-bit counters that are allowed to
+ * roll over, and the index into the array is just "head & (size - 1)". The
+ * count is always "head - tail", even after the counters roll over, so there
+ * is no separate count variable to keep up to date. And because the head and
+ * tail can tell the difference between full and empty on their own, every
+ * slot in the array can be used.
+ * 
+ * All of the functions from the regular Buffer are here, but the sizes and
+ * lengths are given in elements instead of bytes.
+ * 
+ * @section example_code Example Code
+ * 
+ *      uint16_t samples[4096];
+ *      RingBuffer adcRing;
+ *      RingBuffer_Init(&adcRing, samples, 4096, sizeof(samples[0]));
+ * 
+ *      uint16_t value = ADC_GetValue();
+ *      RingBuffer_Write(&adcRing, &value);
+ *      ...
+ *      if(RingBuffer_Read(&adcRing, &value))
+ *      {
+ *          // do something
+ *      }
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+/* overflow callback function. Make your function pointer follow this format */
+typedef void (*RingBufferOverflowCallbackFunc)(void);
+
+typedef struct RingBufferTag
+{
+    bool overflow;
+    bool enableOverwrite;
+
+    struct
+    {
+        uint8_t *buffer;
+        uint32_t size;
+        uint32_t mask;
+        size_t elementSize;
+        uint32_t head;
+        uint32_t tail;
+        bool isMirrored;
+        RingBufferOverflowCallbackFunc bufferOverflowCallbackFunc;
+    } private;
+} RingBuffer;
+
+/**
+ * The variables below should be treated as private. You should only access
+ * them with the use of a function.
+ * 
+ * overflow  true if buffer has overflowed
+ * 
+ * enableOverwrite  if true, the buffer will overwrite if it is full
+ * 
+ * buffer  pointer to the array which will form your ring buffer
+ * 
+ * size  the number of elements in your array. Must be a power of two
+ * 
+ * mask  size - 1. Used in place of modulo division
+ * 
+ * elementSize  the size of each element in bytes
+ * 
+ * head  free running count of elements written into the buffer
+ * 
+ * tail  free running count of elements read from the buffer
+ * 
+ * isMirrored  true if the array is mapped twice back to back in memory
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initializes a RingBuffer object.
+ * 
+ * Does not allow the buffer to overwrite values by default. The number of
+ * elements must be a power of two from 1 to 2^31. If it isn't, the ring
+ * buffer is not set up and the function returns false.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param arrayIn  pointer to the array that you are going to use
+ * 
+ * @param numElements  the number of elements in said array
+ * 
+ * @param elementSize  the size of each element in bytes
+ * 
+ * @return true if the ring buffer was initialized
+ */
+bool RingBuffer_Init(RingBuffer *self, void *arrayIn, uint32_t numElements, size_t elementSize);
+
+/***************************************************************************//**
+ * @brief Initializes a RingBuffer object with overwrite option.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param arrayIn  pointer to the array that you are going to use
+ * 
+ * @param numElements  the number of elements in said array
+ * 
+ * @param elementSize  the size of each element in bytes
+ * 
+ * @param overwrite  enable overwrite of buffer data if true
+ * 
+ * @return true if the ring buffer was initialized
+ */
+bool RingBuffer_InitWithOverwrite(RingBuffer *self, void *arrayIn, uint32_t numElements, size_t elementSize, bool overwrite);
+
+/***************************************************************************//**
+ * @brief Initializes a RingBuffer object on a mirrored array.
+ * 
+ * The array must be followed immediately in memory by a second mapping of the 
+ * same physical memory. You normally won't call this yourself. Call the 
+ * create function for your platform, like RingBuffer_Linux_CreateMirrored, 
+ * which sets up the memory and then calls this function.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param mirroredArray  pointer to the first of the two mappings
+ * 
+ * @param numElements  the number of elements in one mapping
+ * 
+ * @param elementSize  the size of each element in bytes
+ * 
+ * @return true if the ring buffer was initialized
+ */
+bool RingBuffer_InitMirrored(RingBuffer *self, void *mirroredArray, uint32_t numElements, size_t elementSize);
+
+/***************************************************************************//**
+ * @brief Copy an element into the buffer then update the head.
+ * 
+ * If the buffer is full and overwrite is disabled, the element is dropped,
+ * the overflow flag is set and the overflow callback is called.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param element  pointer to the element to store
+ * 
+ * @return true if the element was stored
+ */
+bool RingBuffer_Write(RingBuffer *self, const void *element);
+
+/***************************************************************************//**
+ * @brief Copy an element out of the buffer then update the tail.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param element  pointer to where the element will be copied
+ * 
+ * @return true if there was an element to read
+ */
+bool RingBuffer_Read(RingBuffer *self, void *element);
+
+/***************************************************************************//**
+ * @brief Copy an element out of the buffer but don't update the tail
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param element  pointer to where the element will be copied
+ * 
+ * @return true if there was an element to read
+ */
+bool RingBuffer_Peek(RingBuffer *self, void *element);
+
+/***************************************************************************//**
+ * @brief Put an array of elements into the buffer then update the head.
+ * 
+ * Works the same way as Buffer_WriteArray. With overwrite disabled, as many
+ * elements as will fit are written. With overwrite enabled, the oldest
+ * elements are thrown away to make room.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param array  pointer to the elements to store
+ * 
+ * @param numElements  number of elements to store
+ * 
+ * @return uint32_t  number of elements written
+ */
+uint32_t RingBuffer_WriteArray(RingBuffer *self, const void *array, uint32_t numElements);
+
+/***************************************************************************//**
+ * @brief Read an array of elements from the buffer then update the tail.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param array  pointer to where the elements will be copied
+ * 
+ * @param numElements  the maximum number of elements to read
+ * 
+ * @return uint32_t  number of elements read
+ */
+uint32_t RingBuffer_ReadArray(RingBuffer *self, void *array, uint32_t numElements);
+
+/***************************************************************************//**
+ * @brief Read an array of elements from the buffer but don't update the tail.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param array  pointer to where the elements will be copied
+ * 
+ * @param numElements  the maximum number of elements to read
+ * 
+ * @return uint32_t  number of elements copied
+ */
+uint32_t RingBuffer_PeekArray(RingBuffer *self, void *array, uint32_t numElements);
+
+/***************************************************************************//**
+ * @brief Get the largest contiguous block of free space in the buffer
+ * 
+ * If the ring buffer is mirrored, this is all of the free space.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param region  returns a pointer to the start of the free space
+ * 
+ * @param numElements  returns the number of elements you may write there
+ */
+void RingBuffer_GetWriteRegion(RingBuffer *self, void **region, uint32_t *numElements);
+
+/***************************************************************************//**
+ * @brief Add elements written into the write region to the buffer
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param numElements  the number of elements that were written
+ */
+void RingBuffer_CommitWrite(RingBuffer *self, uint32_t numElements);
+
+/***************************************************************************//**
+ * @brief Get the largest contiguous block of data in the buffer
+ * 
+ * If the ring buffer is mirrored, this is all of the data.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param region  returns a pointer to the oldest element in the buffer
+ * 
+ * @param numElements  returns the number of elements you may read from there
+ */
+void RingBuffer_GetReadRegion(RingBuffer *self, void **region, uint32_t *numElements);
+
+/***************************************************************************//**
+ * @brief Remove elements from the buffer after you are done with them
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param numElements  the number of elements to remove
+ */
+void RingBuffer_ReleaseRead(RingBuffer *self, uint32_t numElements);
+
+/***************************************************************************//**
+ * @brief Clear the buffer
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ */
+void RingBuffer_Flush(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief Get number of elements stored in the buffer
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @return uint32_t  number of elements in the buffer
+ */
+uint32_t RingBuffer_GetCount(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief Get the number of elements the buffer can hold
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @return uint32_t  size of the buffer in elements
+ */
+uint32_t RingBuffer_GetSize(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief Is the buffer full
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @return true if buffer is full
+ */
+bool RingBuffer_IsFull(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief Is there something in the buffer
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @return true if buffer is not empty
+ */
+bool RingBuffer_IsNotEmpty(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief Check if the buffer overflowed
+ * 
+ * The overflow flag is cleared when you call this function. It is also
+ * cleared automatically when space appears in the buffer.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @return true if buffer did overflow
+ */
+bool RingBuffer_DidOverflow(RingBuffer *self);
+
+/***************************************************************************//**
+ * @brief A function pointer that is called when the buffer overflows
+ * 
+ * Only works if you have overwrite disabled.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param Function  format: void SomeFunction(void)
+ */
+void RingBuffer_SetOverflowCallback(RingBuffer *self, RingBufferOverflowCallbackFunc Function);
+
+#endif  /* RING_BUFFER_H */
@@ -0,0 +1,104 @@
+/***************************************************************************//**
+ * @brief Mirrored Ring Buffer Memory for Linux
+ * 
+ * @file RingBuffer_Linux.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      The trick is done in three steps. First, create an anonymous file in
+ * memory with memfd_create and set its size. Second, reserve an address range
+ * twice as big so that nothing else can land in the middle of it. Third, map
+ * the file into the first half and then again into the second half of that
+ * range with MAP_FIXED. Both halves are MAP_SHARED, so they are the same
+ * physical pages. Once both mappings are made, the file descriptor can be
+ * closed. The memory stays around until it is unmapped.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include "RingBuffer_Linux.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+
+// *****************************************************************************
+
+bool RingBuffer_Linux_CreateMirrored(RingBuffer *self, uint32_t numElements, size_t elementSize)
+{
+    size_t numBytes = (size_t)numElements * elementSize;
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if(numBytes == 0 || pageSize <= 0 || numBytes % (size_t)pageSize != 0)
+        return false;
+
+    int fd = memfd_create("RingBuffer", MFD_CLOEXEC);
+    if(fd < 0)
+        return false;
+
+    if(ftruncate(fd, numBytes) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    /* Reserve the whole range first, then put both copies on top of it */
+    uint8_t *base = mmap(NULL, 2 * numBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+
+    void *first = mmap(base, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(base + numBytes, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+
+    if(first != base || second != base + numBytes)
+    {
+        munmap(base, 2 * numBytes);
+        return false;
+    }
+
+    if(!RingBuffer_InitMirrored(self, base, numElements, elementSize))
+    {
+        munmap(base, 2 * numBytes);
+        return false;
+    }
+    return true;
+}
+
+// *****************************************************************************
+
+void RingBuffer_Linux_DestroyMirrored(RingBuffer *self)
+{
+    if(self->private.buffer == NULL || !self->private.isMirrored)
+        return;
+
+    size_t numBytes = (size_t)self->private.size * self->private.elementSize;
+    munmap(self->private.buffer, 2 * numBytes);
+    self->private.buffer = NULL;
+    self->private.isMirrored = false;
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,86 @@
+/***************************************************************************//**
+ * @brief Mirrored Ring Buffer Memory for Linux Header
+ * 
+ * @file RingBuffer_Linux.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      This is the Linux specific piece of the mirrored RingBuffer. It asks
+ * the kernel for a block of memory, then maps that memory twice, one right
+ * after the other. Writing to element [i] and element [i + size] touches the
+ * same byte. Once that is set up, it hands the memory to
+ * RingBuffer_InitMirrored and you use the regular RingBuffer functions from
+ * then on. Your framing and parsing code doesn't know the difference.
+ * 
+ * This is the one place in the ring buffer code that uses dynamic memory,
+ * because the mapping has to come from the operating system. The total size
+ * in bytes (numElements * elementSize) must be a multiple of the page size,
+ * which is usually 4096 bytes.
+ * 
+ * @section example_code Example Code
+ * 
+ *      RingBuffer rxRing;
+ *      RingBuffer_Linux_CreateMirrored(&rxRing, 65536, 1);
+ * 
+ *      uint8_t *data;
+ *      uint32_t length;
+ *      RingBuffer_GetReadRegion(&rxRing, (void **)&data, &length);
+ *      uint8_t *end = memchr(data, '\n', length); // never have to wrap
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef RING_BUFFER_LINUX_H
+#define RING_BUFFER_LINUX_H
+
+#include "RingBuffer.h"
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Create a mirrored RingBuffer
+ * 
+ * Maps the memory twice and initializes the RingBuffer with it. The number of
+ * elements must be a power of two and the size in bytes must be a multiple
+ * of the page size.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ * 
+ * @param numElements  the number of elements in the ring buffer
+ * 
+ * @param elementSize  the size of each element in bytes
+ * 
+ * @return true if the memory was mapped and the ring buffer is ready
+ */
+bool RingBuffer_Linux_CreateMirrored(RingBuffer *self, uint32_t numElements, size_t elementSize);
+
+/***************************************************************************//**
+ * @brief Give the mirrored memory back to the operating system
+ * 
+ * Only call this on a RingBuffer made with RingBuffer_Linux_CreateMirrored.
+ * 
+ * @param self  pointer to the RingBuffer that you are using
+ */
+void RingBuffer_Linux_DestroyMirrored(RingBuffer *self);
+
+#endif  /* RING_BUFFER_LINUX_H */
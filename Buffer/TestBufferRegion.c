@@ -0,0 +1,115 @@
+/* Program to test the Buffer region functions on a wrapped ring - MS
+
+   Moves the start of a 16 byte buffer to every position in the ring. Fills
+   it using only Buffer_GetWriteRegion and Buffer_CommitWrite, then empties
+   it using only Buffer_GetReadRegion and Buffer_ReleaseRead. Checks that
+   each region is the contiguous part up to the end of the array, that the
+   next one starts back at the beginning, that full and empty give a length
+   of zero, that commits and releases past the count are cut off, and that
+   the bytes come out in order. Returns 1 if anything is wrong.
+
+   gcc -O2 TestBufferRegion.c Buffer.c -o TestBufferRegion
+   ./TestBufferRegion */
+
+#include <stdio.h>
+#include <string.h>
+#include "Buffer.h"
+
+#define RING_SIZE   16
+#define CAPACITY    (RING_SIZE - 1)
+
+static uint32_t errors;
+
+static void Check(bool ok, const char *what, uint16_t start)
+{
+    if(!ok && errors++ < 20)
+        printf("FAIL %s, ring starting at %u\n", what, start);
+}
+
+/* Empty the buffer with its oldest byte at position start of the array */
+static void MoveStart(Buffer *buffer, uint16_t start)
+{
+    uint8_t filler[RING_SIZE] = {0}, *region;
+    uint16_t length;
+
+    /* The write region starts where the next byte will go */
+    Buffer_Flush(buffer);
+    Buffer_GetWriteRegion(buffer, &region, &length);
+    length = (start + RING_SIZE - (region - buffer->private.buffer)) % RING_SIZE;
+    Buffer_WriteArray(buffer, filler, length);
+    Buffer_ReadArray(buffer, filler, length);
+}
+
+int main(void)
+{
+    uint8_t array[RING_SIZE], data[CAPACITY], *region;
+    uint16_t length;
+    Buffer buffer = {0};
+
+    Buffer_Init(&buffer, array, RING_SIZE);
+
+    for(uint16_t start = 0; start < RING_SIZE; start++)
+    {
+        uint16_t total = 0, pieces = 0;
+
+        MoveStart(&buffer, start);
+        for(uint16_t i = 0; i < CAPACITY; i++)
+            data[i] = (uint8_t)(start * 16 + i + 1);
+
+        /* Empty. Nothing to read. The free space runs to the end of the
+        array, except that the last slot is kept open when the tail is at
+        zero so the head never lands on the tail. */
+        Buffer_GetReadRegion(&buffer, &region, &length);
+        Check(region == array + start && length == 0, "empty read region", start);
+        Buffer_GetWriteRegion(&buffer, &region, &length);
+        Check(region == array + start &&
+            length == (start == 0 ? CAPACITY : RING_SIZE - start),
+            "empty write region", start);
+
+        /* Fill it in at most two pieces */
+        while(length > 0)
+        {
+            Check(region == (pieces == 0 ? array + start : array), "write region start",
+                start);
+            memcpy(region, &data[total], length);
+            Buffer_CommitWrite(&buffer, length);
+            total += length;
+            pieces++;
+            Buffer_GetWriteRegion(&buffer, &region, &length);
+        }
+        Check(total == CAPACITY && Buffer_GetCount(&buffer) == CAPACITY &&
+            pieces == (start <= 1 ? 1 : 2), "filled", start);
+
+        /* Full. Committing more does nothing. */
+        Buffer_CommitWrite(&buffer, 3);
+        Buffer_GetWriteRegion(&buffer, &region, &length);
+        Check(length == 0 && Buffer_GetCount(&buffer) == CAPACITY, "commit when full",
+            start);
+
+        /* The first read region is everything up to the end of the array or
+        the head. Release one byte of it, then the rest. */
+        Buffer_GetReadRegion(&buffer, &region, &length);
+        Check(region == array + start &&
+            length == (start <= 1 ? CAPACITY : RING_SIZE - start),
+            "full read region", start);
+        Check(memcmp(region, data, length) == 0, "read region data", start);
+        Buffer_ReleaseRead(&buffer, 1);
+        Check(Buffer_GetCount(&buffer) == CAPACITY - 1 && Buffer_Peek(&buffer) == data[1],
+            "release one", start);
+        Buffer_ReleaseRead(&buffer, length - 1);
+        total = length;
+
+        /* Whatever wrapped around starts at the beginning of the array */
+        Buffer_GetReadRegion(&buffer, &region, &length);
+        Check(length == CAPACITY - total && (length == 0 || region == array) &&
+            memcmp(region, &data[total], length) == 0, "wrapped read region", start);
+
+        /* Releasing more than the count only takes what is there */
+        Buffer_ReleaseRead(&buffer, RING_SIZE);
+        Buffer_GetReadRegion(&buffer, &region, &length);
+        Check(Buffer_GetCount(&buffer) == 0 && length == 0, "release past count", start);
+    }
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+/* Program to test the Buffer search functions on a wrapped ring - MS
+
+   Moves the start of a 16 byte buffer to every position in the ring and
+   writes the same 10 bytes each time, so the data goes around the end of the
+   array in every possible place. Checks Buffer_FindByte,
+   Buffer_FindSequence, and Buffer_ReadUntil against where the bytes really
+   are, including a sequence split across the end, a delimiter past
+   maxLength, and searches that have no match. Returns 1 if anything is
+   wrong.
+
+   gcc -O2 TestBufferSearch.c Buffer.c -o TestBufferSearch
+   ./TestBufferSearch */
+
+#include <stdio.h>
+#include <string.h>
+#include "Buffer.h"
+
+#define RING_SIZE   16
+
+static uint32_t errors;
+
+static void Check(bool ok, const char *what, uint16_t start)
+{
+    if(!ok && errors++ < 20)
+        printf("FAIL %s, ring starting at %u\n", what, start);
+}
+
+/* Empty the buffer with its oldest byte at position start of the array */
+static void MoveStart(Buffer *buffer, uint16_t start)
+{
+    uint8_t filler[RING_SIZE] = {0}, *region;
+    uint16_t length;
+
+    /* The write region starts where the next byte will go */
+    Buffer_Flush(buffer);
+    Buffer_GetWriteRegion(buffer, &region, &length);
+    length = (start + RING_SIZE - (region - buffer->private.buffer)) % RING_SIZE;
+    Buffer_WriteArray(buffer, filler, length);
+    Buffer_ReadArray(buffer, filler, length);
+}
+
+int main(void)
+{
+    const uint8_t data[] = "abc\ndefg\nh";
+    const uint16_t dataLength = sizeof(data) - 1;
+    uint8_t array[RING_SIZE], frame[RING_SIZE];
+    uint16_t offset;
+    Buffer buffer = {0};
+
+    Buffer_Init(&buffer, array, RING_SIZE);
+
+    for(uint16_t start = 0; start < RING_SIZE; start++)
+    {
+        uint8_t *region;
+        uint16_t regionLength;
+
+        MoveStart(&buffer, start);
+        Buffer_WriteArray(&buffer, data, dataLength);
+        Buffer_GetReadRegion(&buffer, &region, &regionLength);
+        Check(region == array + start, "start position", start);
+
+        /* Bytes on both sides of the end of the array */
+        Check(Buffer_FindByte(&buffer, 'a', &offset) && offset == 0, "FindByte first", start);
+        Check(Buffer_FindByte(&buffer, 'g', &offset) && offset == 7, "FindByte g", start);
+        Check(Buffer_FindByte(&buffer, 'h', &offset) && offset == 9, "FindByte last", start);
+        Check(!Buffer_FindByte(&buffer, 'z', &offset), "FindByte no match", start);
+
+        /* Every sequence of every length that is in the data is found at
+        its first place. When the ring starts at 10 or later, some of them
+        are split across the end. */
+        for(uint16_t i = 0; i < dataLength; i++)
+        {
+            for(uint16_t length = 1; i + length <= dataLength; length++)
+            {
+                const uint8_t *first = NULL;
+
+                for(uint16_t j = 0; j + length <= dataLength && !first; j++)
+                {
+                    if(memcmp(&data[j], &data[i], length) == 0)
+                        first = &data[j];
+                }
+                Check(Buffer_FindSequence(&buffer, &data[i], length, &offset) &&
+                    offset == first - data, "FindSequence", start);
+            }
+        }
+
+        /* The first few bytes match at the end of the data, but the rest
+        would be past the count. Also one that is too long, and one with the
+        first byte in the buffer but nothing after it. */
+        Check(!Buffer_FindSequence(&buffer, (const uint8_t *)"\nhX", 3, &offset),
+            "FindSequence past the count", start);
+        Check(!Buffer_FindSequence(&buffer, (const uint8_t *)"abc\ndefg\nhX", 11, &offset),
+            "FindSequence longer than count", start);
+        Check(!Buffer_FindSequence(&buffer, (const uint8_t *)"dX", 2, &offset),
+            "FindSequence no match", start);
+        Check(!Buffer_FindSequence(&buffer, (const uint8_t *)"a", 0, &offset),
+            "FindSequence length 0", start);
+
+        /* The first frame is 4 bytes. A maxLength of 3 leaves it alone. */
+        Check(Buffer_ReadUntil(&buffer, '\n', frame, 3) == 0 &&
+            Buffer_GetCount(&buffer) == dataLength, "ReadUntil past maxLength", start);
+        Check(Buffer_ReadUntil(&buffer, '\n', frame, 4) == 4 &&
+            memcmp(frame, "abc\n", 4) == 0, "ReadUntil first frame", start);
+        Check(Buffer_ReadUntil(&buffer, '\n', frame, RING_SIZE) == 5 &&
+            memcmp(frame, "defg\n", 5) == 0, "ReadUntil second frame", start);
+
+        /* Only "h" is left, with no delimiter */
+        Check(Buffer_ReadUntil(&buffer, '\n', frame, RING_SIZE) == 0 &&
+            Buffer_GetCount(&buffer) == 1 && Buffer_Peek(&buffer) == 'h',
+            "ReadUntil no delimiter", start);
+    }
+
+    /* An empty buffer has nothing to find */
+    Buffer_Flush(&buffer);
+    Check(!Buffer_FindByte(&buffer, 'h', &offset), "FindByte empty", 0);
+    Check(!Buffer_FindSequence(&buffer, (const uint8_t *)"h", 1, &offset),
+        "FindSequence empty", 0);
+    Check(Buffer_ReadUntil(&buffer, 'h', frame, RING_SIZE) == 0, "ReadUntil empty", 0);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+/* Program to compare Buffer byte functions against the array functions - MS
+
+   Moves 200 byte frames through a 255 byte buffer, first one byte at a time
+   and then with Buffer_WriteArray and Buffer_ReadArray. Checks that the data
+   comes out the same both ways and prints the throughput of each.
+
+   gcc -O2 TestBufferSpeed.c Buffer.c -o TestBufferSpeed
+   ./TestBufferSpeed [numFrames] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Buffer.h"
+
+#define FRAME_SIZE          200
+#define DEFAULT_NUM_FRAMES  2000000UL
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t array[255];
+    uint8_t frameIn[FRAME_SIZE], frameOut[FRAME_SIZE];
+    uint32_t numFrames = DEFAULT_NUM_FRAMES;
+    uint32_t errors = 0;
+    Buffer buffer = {0};
+    double start, byteTime, arrayTime;
+
+    if(argc > 1)
+        numFrames = strtoul(argv[1], NULL, 0);
+
+    for(uint16_t i = 0; i < FRAME_SIZE; i++)
+        frameIn[i] = (uint8_t)(i * 7 + 3);
+
+    /* One byte at a time */
+    Buffer_Init(&buffer, array, sizeof(array));
+    start = Seconds();
+    for(uint32_t f = 0; f < numFrames; f++)
+    {
+        frameIn[0] = (uint8_t)f;
+        for(uint16_t i = 0; i < FRAME_SIZE; i++)
+            Buffer_WriteByte(&buffer, frameIn[i]);
+        for(uint16_t i = 0; i < FRAME_SIZE; i++)
+            frameOut[i] = Buffer_ReadByte(&buffer);
+        if(memcmp(frameIn, frameOut, FRAME_SIZE) != 0)
+            errors++;
+    }
+    byteTime = Seconds() - start;
+
+    /* Whole frames */
+    Buffer_Init(&buffer, array, sizeof(array));
+    start = Seconds();
+    for(uint32_t f = 0; f < numFrames; f++)
+    {
+        frameIn[0] = (uint8_t)f;
+        if(Buffer_WriteArray(&buffer, frameIn, FRAME_SIZE) != FRAME_SIZE)
+            errors++;
+        if(Buffer_ReadArray(&buffer, frameOut, FRAME_SIZE) != FRAME_SIZE)
+            errors++;
+        if(memcmp(frameIn, frameOut, FRAME_SIZE) != 0)
+            errors++;
+    }
+    arrayTime = Seconds() - start;
+
+    double bytes = (double)numFrames * FRAME_SIZE;
+    printf("Byte functions:  %8.1f MB/s\n", bytes / byteTime / 1e6);
+    printf("Array functions: %8.1f MB/s\n", bytes / arrayTime / 1e6);
+    printf("Speedup: %.1fx\n", byteTime / arrayTime);
+
+    if(errors)
+    {
+        printf("FAIL: %u bad frames\n", errors);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
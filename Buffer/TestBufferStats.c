@@ -0,0 +1,130 @@
+/* Program to test the Buffer statistics - MS
+
+   Runs a 16 byte buffer through byte writes, array writes, region commits,
+   reads, overflows, and a flush, and checks Buffer_GetStats after each step
+   against the counts worked out by hand. Then does the same in overwrite
+   mode, where the bytes pushed out of the buffer count as dropped. Checks
+   that the histogram always adds up to the number of writes, and that
+   Buffer_ResetStats starts the high water mark at the current count.
+   Returns 1 if anything is wrong.
+
+   The statistics have to be turned on for both files.
+
+   gcc -O2 -DBUFFER_ENABLE_STATS=1 TestBufferStats.c Buffer.c -o TestBufferStats
+   ./TestBufferStats */
+
+#include <stdio.h>
+#include <string.h>
+#include "Buffer.h"
+
+#if !BUFFER_ENABLE_STATS
+#error "Compile with -DBUFFER_ENABLE_STATS=1"
+#endif
+
+#define RING_SIZE   16
+#define CAPACITY    (RING_SIZE - 1)
+
+static uint32_t errors;
+
+static void Check(Buffer *buffer, const char *what, uint16_t highWaterMark,
+    uint32_t bytesIn, uint32_t bytesOut, uint32_t overflowCount, uint32_t bytesDropped,
+    uint32_t numWrites)
+{
+    BufferStats stats;
+    uint32_t total = 0;
+
+    Buffer_GetStats(buffer, &stats);
+    for(uint16_t i = 0; i < BUFFER_STATS_NUM_BINS; i++)
+        total += stats.histogram[i];
+
+    if(stats.highWaterMark != highWaterMark || stats.bytesIn != bytesIn ||
+        stats.bytesOut != bytesOut || stats.overflowCount != overflowCount ||
+        stats.bytesDropped != bytesDropped || total != numWrites)
+    {
+        if(errors++ < 20)
+        {
+            printf("FAIL %s: high water %u in %u out %u overflows %u dropped %u writes %u\n",
+                what, stats.highWaterMark, stats.bytesIn, stats.bytesOut,
+                stats.overflowCount, stats.bytesDropped, total);
+        }
+    }
+}
+
+int main(void)
+{
+    uint8_t array[RING_SIZE], data[40] = {0}, *region;
+    uint16_t length;
+    BufferStats stats;
+    Buffer buffer = {0};
+
+    Buffer_Init(&buffer, array, RING_SIZE);
+    Check(&buffer, "init", 0, 0, 0, 0, 0, 0);
+
+    /* One byte at a time. Each write lands in the bin for the count after
+    it, which is count * 8 / 16. */
+    for(uint16_t i = 0; i < 10; i++)
+        Buffer_WriteByte(&buffer, i);
+    Check(&buffer, "write bytes", 10, 10, 0, 0, 0, 10);
+    Buffer_GetStats(&buffer, &stats);
+    if(stats.histogram[0] != 1 || stats.histogram[1] != 2 || stats.histogram[4] != 2 ||
+        stats.histogram[5] != 1 || stats.histogram[6] != 0)
+    {
+        printf("FAIL histogram bins\n");
+        errors++;
+    }
+
+    /* Reading doesn't lower the high water mark */
+    Buffer_ReadArray(&buffer, data, 4);
+    Buffer_ReadByte(&buffer);
+    Check(&buffer, "read", 10, 10, 5, 0, 0, 10);
+
+    /* 5 in the buffer leaves room for 10 of these 20. One overflow. */
+    Buffer_WriteArray(&buffer, data, 20);
+    Check(&buffer, "write array overflow", CAPACITY, 20, 5, 1, 10, 11);
+
+    /* Full, and not overwriting. Each byte is one more overflow. */
+    Buffer_WriteByte(&buffer, 0);
+    Buffer_WriteByte(&buffer, 0);
+    Check(&buffer, "write byte overflow", CAPACITY, 20, 5, 3, 12, 13);
+
+    /* The high water mark starts over at the current count */
+    Buffer_ResetStats(&buffer);
+    Check(&buffer, "reset when full", CAPACITY, 0, 0, 0, 0, 0);
+    Buffer_Flush(&buffer);
+    Check(&buffer, "flush", CAPACITY, 0, CAPACITY, 0, 0, 0);
+    Buffer_WriteArray(&buffer, data, 3);
+    Buffer_ResetStats(&buffer);
+    Check(&buffer, "reset with 3", 3, 0, 0, 0, 0, 0);
+
+    /* The region functions count the same as the others */
+    Buffer_GetWriteRegion(&buffer, &region, &length);
+    Buffer_CommitWrite(&buffer, 2);
+    Buffer_CommitWrite(&buffer, RING_SIZE);
+    Check(&buffer, "commit write", CAPACITY, CAPACITY - 3, 0, 0, 0, 2);
+    Buffer_GetReadRegion(&buffer, &region, &length);
+    Buffer_ReleaseRead(&buffer, 7);
+    Buffer_ReleaseRead(&buffer, RING_SIZE);
+    Check(&buffer, "release read", CAPACITY, CAPACITY - 3, CAPACITY, 0, 0, 2);
+
+    /* Overwrite mode. Each byte written into a full buffer pushes one old
+    byte out, and that byte is counted as dropped. */
+    memset(&buffer, 0, sizeof(buffer));
+    Buffer_InitWithOverwrite(&buffer, array, RING_SIZE, true);
+    for(uint16_t i = 0; i < CAPACITY + 5; i++)
+        Buffer_WriteByte(&buffer, i);
+    Check(&buffer, "overwrite bytes", CAPACITY, CAPACITY + 5, 0, 5, 5, CAPACITY + 5);
+
+    /* 40 bytes into a full buffer. The first 25 never make it in, and the
+    last 15 push out all 15 that were there. */
+    Buffer_WriteArray(&buffer, data, 40);
+    Check(&buffer, "overwrite array", CAPACITY, CAPACITY + 20, 0, 6, 45, CAPACITY + 6);
+
+    /* With room for some of them, only the ones that don't fit push out old
+    bytes */
+    Buffer_ReadArray(&buffer, data, 10);
+    Buffer_WriteArray(&buffer, data, 12);
+    Check(&buffer, "overwrite partial", CAPACITY, CAPACITY + 32, 10, 7, 47, CAPACITY + 7);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
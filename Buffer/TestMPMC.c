@@ -0,0 +1,155 @@
+/* Program to benchmark BufferMPMC with different numbers of threads - MS
+
+   Runs 1, 2, 4, 8 and 16 threads. Every thread writes a record and then reads
+   a record, over and over, so every thread is both a producer and a consumer.
+   Each record holds the thread number and a count, and every thread adds up
+   what it writes and what it reads. If the totals don't match at the end, a
+   record was lost or read twice. Reports millions of operations per second
+   and the 50%, 99% and 99.9% latency of a write/read pair.
+
+   gcc -O2 -std=c11 -pthread TestMPMC.c BufferMPMC.c -o TestMPMC
+   ./TestMPMC [operationsPerThread] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "BufferMPMC.h"
+
+#define NUM_SLOTS           1024
+#define MAX_THREADS         16
+#define DEFAULT_NUM_OPS     1000000UL
+#define SAMPLE_EVERY        16
+
+typedef struct
+{
+    uint32_t thread;
+    uint32_t count;
+    uint64_t padding;   /* never used. Makes each record 16 bytes */
+} Record;
+
+typedef struct
+{
+    pthread_t handle;
+    uint32_t id;
+    uint64_t sumWritten;
+    uint64_t sumRead;
+    uint64_t *latency;
+    uint32_t numSamples;
+} Worker;
+
+static Record records[NUM_SLOTS];
+static BufferMPMCSequence sequence[NUM_SLOTS];
+static BufferMPMC queue;
+static uint32_t numOps = DEFAULT_NUM_OPS;
+static atomic_uint startFlag;
+
+static uint64_t Nanoseconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+static int CompareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void *Work(void *arg)
+{
+    Worker *w = arg;
+    Record r = {0};
+
+    while(atomic_load(&startFlag) == 0)
+        sched_yield();
+
+    for(uint32_t i = 0; i < numOps; i++)
+    {
+        uint64_t start = 0;
+        if(i % SAMPLE_EVERY == 0)
+            start = Nanoseconds();
+
+        r.thread = w->id;
+        r.count = i;
+        while(!BufferMPMC_Write(&queue, &r))
+            sched_yield();
+        w->sumWritten += ((uint64_t)w->id << 32) | i;
+
+        while(!BufferMPMC_Read(&queue, &r))
+            sched_yield();
+        w->sumRead += ((uint64_t)r.thread << 32) | r.count;
+
+        if(i % SAMPLE_EVERY == 0)
+            w->latency[w->numSamples++] = Nanoseconds() - start;
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    static Worker workers[MAX_THREADS];
+    uint32_t threadCounts[] = {1, 2, 4, 8, 16};
+    int result = 0;
+
+    if(argc > 1)
+        numOps = strtoul(argv[1], NULL, 0);
+
+    uint32_t samplesPerThread = numOps / SAMPLE_EVERY + 1;
+    uint64_t *allSamples = malloc(sizeof(uint64_t) * samplesPerThread * MAX_THREADS);
+
+    printf("threads,Mops/s,p50 ns,p99 ns,p99.9 ns,result\n");
+
+    for(uint32_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+    {
+        uint32_t numThreads = threadCounts[t];
+        uint64_t written = 0, read = 0;
+        uint32_t totalSamples = 0;
+
+        BufferMPMC_Init(&queue, records, sequence, NUM_SLOTS, sizeof(Record));
+        atomic_store(&startFlag, 0);
+
+        for(uint32_t i = 0; i < numThreads; i++)
+        {
+            memset(&workers[i], 0, sizeof(Worker));
+            workers[i].id = i;
+            workers[i].latency = &allSamples[i * samplesPerThread];
+            pthread_create(&workers[i].handle, NULL, Work, &workers[i]);
+        }
+
+        uint64_t start = Nanoseconds();
+        atomic_store(&startFlag, 1);
+        for(uint32_t i = 0; i < numThreads; i++)
+        {
+            pthread_join(workers[i].handle, NULL);
+            written += workers[i].sumWritten;
+            read += workers[i].sumRead;
+        }
+        double seconds = (Nanoseconds() - start) * 1e-9;
+
+        /* Squeeze all the samples together and sort them */
+        for(uint32_t i = 0; i < numThreads; i++)
+        {
+            memmove(&allSamples[totalSamples], workers[i].latency, workers[i].numSamples * sizeof(uint64_t));
+            totalSamples += workers[i].numSamples;
+        }
+        qsort(allSamples, totalSamples, sizeof(uint64_t), CompareU64);
+
+        /* Two operations (a write and a read) per loop */
+        double mops = 2.0 * numOps * numThreads / seconds / 1e6;
+        bool pass = (written == read) && !BufferMPMC_IsNotEmpty(&queue);
+        printf("%u,%.2f,%llu,%llu,%llu,%s\n", numThreads, mops,
+            (unsigned long long)allSamples[totalSamples / 2],
+            (unsigned long long)allSamples[(uint64_t)totalSamples * 99 / 100],
+            (unsigned long long)allSamples[(uint64_t)totalSamples * 999 / 1000],
+            pass ? "PASS" : "FAIL");
+        if(!pass)
+            result = 1;
+    }
+
+    free(allSamples);
+    return result;
+}
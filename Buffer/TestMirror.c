@@ -0,0 +1,81 @@
+/* Program to test the mirrored RingBuffer on Linux - MS
+
+   Pushes lines of text through a mirrored ring buffer that is deliberately
+   not a multiple of the line length, so the lines wrap all over the place.
+   Each time, the read region must hold all of the data in one piece, and
+   memchr must find the end of every line without any wrap handling. Each
+   line is copied out before sscanf, since the ring isn't NUL-terminated.
+
+   gcc -O2 TestMirror.c RingBuffer.c RingBuffer_Linux.c -o TestMirror */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RingBuffer_Linux.h"
+
+#define RING_SIZE   4096
+#define NUM_LINES   100000
+
+int main(void)
+{
+    RingBuffer ring;
+    char line[64];
+    uint32_t errors = 0;
+    uint32_t linesIn = 0, linesOut = 0;
+
+    if(!RingBuffer_Linux_CreateMirrored(&ring, RING_SIZE, 1))
+    {
+        printf("FAIL: could not create the mirrored memory\n");
+        return 1;
+    }
+
+    while(linesOut < NUM_LINES)
+    {
+        /* Fill it up with as many lines as will fit */
+        while(linesIn < NUM_LINES)
+        {
+            int length = snprintf(line, sizeof(line), "line %u,%u\n", linesIn, linesIn * 7u);
+            if(RingBuffer_GetSize(&ring) - RingBuffer_GetCount(&ring) < (uint32_t)length)
+                break;
+            RingBuffer_WriteArray(&ring, line, length);
+            linesIn++;
+        }
+
+        uint8_t *data;
+        uint32_t length;
+        RingBuffer_GetReadRegion(&ring, (void **)&data, &length);
+        if(length != RingBuffer_GetCount(&ring))
+            errors++;
+
+        /* Parse every complete line straight out of the ring */
+        uint8_t *start = data;
+        uint8_t *end;
+        while((end = memchr(start, '\n', length - (start - data))) != NULL)
+        {
+            /* The ring has no NUL at the end, and sscanf would look for one
+            past the end of the mirrored memory. Copy just this line out
+            first, so nothing reads outside of start to end. */
+            unsigned a, b;
+            size_t lineLength = end - start;
+            if(lineLength >= sizeof(line))
+                lineLength = sizeof(line) - 1;
+            memcpy(line, start, lineLength);
+            line[lineLength] = '\0';
+            if(sscanf(line, "line %u,%u", &a, &b) != 2 || a != linesOut || b != a * 7u)
+                errors++;
+            linesOut++;
+            start = end + 1;
+        }
+        RingBuffer_ReleaseRead(&ring, start - data);
+    }
+
+    RingBuffer_Linux_DestroyMirrored(&ring);
+
+    if(errors)
+    {
+        printf("FAIL: %u errors\n", errors);
+        return 1;
+    }
+    printf("PASS: %u lines parsed in place\n", linesOut);
+    return 0;
+}
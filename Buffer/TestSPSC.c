@@ -0,0 +1,116 @@
+/* Program to stress test BufferSPSC with two threads - MS
+
+   One thread writes a long pseudorandom byte sequence into the buffer and the
+   other thread reads it back out and compares it to the same sequence. If a
+   byte is ever lost or duplicated, the two sequences fall out of step and the
+   very next compare fails. The default runs 4 billion bytes. You can give a
+   different number of bytes and buffer size on the command line.
+
+   gcc -O2 -std=c11 -pthread TestSPSC.c BufferSPSC.c -o TestSPSC
+   ./TestSPSC [numBytes] [bufferSize] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "BufferSPSC.h"
+
+#define DEFAULT_NUM_BYTES   4000000000ULL
+#define DEFAULT_SIZE        256
+#define MAX_SIZE            65536
+
+static BufferSPSC spsc;
+static uint8_t array[MAX_SIZE];
+static uint64_t numBytes = DEFAULT_NUM_BYTES;
+static uint64_t errors = 0;
+static uint64_t firstErrorIndex = 0;
+
+/* Both threads step their own copy of this to get the expected sequence */
+static inline uint8_t NextPattern(uint32_t *x)
+{
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return (uint8_t)(*x >> 24);
+}
+
+static void *Producer(void *arg)
+{
+    uint32_t x = 2463534242UL;
+    (void)arg;
+
+    for(uint64_t i = 0; i < numBytes; i++)
+    {
+        uint8_t data = NextPattern(&x);
+
+        /* Give up the CPU while waiting in case there is only one core */
+        while(BufferSPSC_IsFull(&spsc))
+            sched_yield();
+        BufferSPSC_WriteByte(&spsc, data);
+    }
+    return NULL;
+}
+
+static void *Consumer(void *arg)
+{
+    uint32_t x = 2463534242UL;
+    (void)arg;
+
+    for(uint64_t i = 0; i < numBytes; i++)
+    {
+        uint8_t expected = NextPattern(&x);
+
+        while(!BufferSPSC_IsNotEmpty(&spsc))
+            sched_yield();
+        if(BufferSPSC_ReadByte(&spsc) != expected)
+        {
+            if(errors == 0)
+                firstErrorIndex = i;
+            errors++;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t size = DEFAULT_SIZE;
+    pthread_t producerThread, consumerThread;
+    struct timespec start, end;
+
+    if(argc > 1)
+        numBytes = strtoull(argv[1], NULL, 0);
+    if(argc > 2)
+        size = strtoul(argv[2], NULL, 0);
+    if(size < 2 || size > MAX_SIZE)
+    {
+        printf("Buffer size must be 2 to %u\n", MAX_SIZE);
+        return 1;
+    }
+
+    BufferSPSC_Init(&spsc, array, size);
+    printf("Moving %llu bytes through a %u byte buffer...\n",
+        (unsigned long long)numBytes, size);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&consumerThread, NULL, Consumer, NULL);
+    pthread_create(&producerThread, NULL, Producer, NULL);
+    pthread_join(producerThread, NULL);
+    pthread_join(consumerThread, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("Time: %.2f s (%.1f MB/s)\n", seconds, numBytes / seconds / 1e6);
+
+    if(errors || BufferSPSC_IsNotEmpty(&spsc) || BufferSPSC_DidOverflow(&spsc))
+    {
+        printf("FAIL: %llu mismatched bytes. First at byte %llu. %u bytes left over\n",
+            (unsigned long long)errors, (unsigned long long)firstErrorIndex,
+            BufferSPSC_GetCount(&spsc));
+        return 1;
+    }
+    printf("PASS: no lost or duplicated bytes\n");
+    return 0;
+}
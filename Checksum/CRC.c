@@ -0,0 +1,518 @@
+/***************************************************************************//**
+ * @brief Parameterized CRC Library
+ * 
+ * @file CRC.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * @date 10/16/26  Added streaming update/final functions
+ * @date 10/16/26  Added update function hook for hardware CRC
+ * @date 10/16/26  Added CRC_Combine
+ * 
+ * @details
+ *      See CRC.h. Internally there are only two kinds of CRC. If the input is
+ * reflected, the register is shifted right and the polynomial is reflected to
+ * match. If it isn't, the register is shifted left, and everything is shifted
+ * up so that the top bit of the CRC is bit 31. That way the top bit is always
+ * in the same spot no matter what the width is. The reflect out and final XOR
+ * are only done once at the end.
+ * 
+ * Slicing-by-8 uses eight tables. Table 0 is the normal byte table. Table k
+ * is what you get if you run a byte through table 0 and then k more zero
+ * bytes. Eight bytes are XOR'd into the register at once and then eight
+ * lookups are done in parallel. The bytes are read one at a time and put
+ * together with shifts, so that it works on any endianness and alignment.
+ * GCC and Clang turn that back into a single load.
+ * 
+ * For CRC_Combine, think about what the register does. The CRC of A then B 
+ * is the register after A, run through B. Because the math is linear, that 
+ * is the same as running the register after A through len(B) zeros, then 
+ * XOR'ing in the CRC of B started from a register of zero. The CRC of B that 
+ * was handed to us started from the initial value instead, so that part is 
+ * taken back out the same way. It all works out to:
+ * 
+ *      regAB = zeros(regA ^ init, lenB) ^ regB
+ * 
+ * The final reflect and XOR have to be undone first to get the registers 
+ * back. The zeros operator is a 32 x 32 matrix, built and squared the same 
+ * way Mark Adler does it in zlib's crc32_combine.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "CRC.h"
+#include <stddef.h>
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+const CRCModel CRC_MODEL_CRC8 =
+    {.width = 8, .poly = 0x07, .init = 0x00, .refIn = false, .refOut = false,
+    .xorOut = 0x00, .check = 0xF4};
+
+const CRCModel CRC_MODEL_CRC8_MAXIM =
+    {.width = 8, .poly = 0x31, .init = 0x00, .refIn = true, .refOut = true,
+    .xorOut = 0x00, .check = 0xA1};
+
+const CRCModel CRC_MODEL_CRC16_CCITT_FALSE =
+    {.width = 16, .poly = 0x1021, .init = 0xFFFF, .refIn = false, .refOut = false,
+    .xorOut = 0x0000, .check = 0x29B1};
+
+const CRCModel CRC_MODEL_CRC16_KERMIT =
+    {.width = 16, .poly = 0x1021, .init = 0x0000, .refIn = true, .refOut = true,
+    .xorOut = 0x0000, .check = 0x2189};
+
+const CRCModel CRC_MODEL_CRC16_XMODEM =
+    {.width = 16, .poly = 0x1021, .init = 0x0000, .refIn = false, .refOut = false,
+    .xorOut = 0x0000, .check = 0x31C3};
+
+const CRCModel CRC_MODEL_CRC16_MODBUS =
+    {.width = 16, .poly = 0x8005, .init = 0xFFFF, .refIn = true, .refOut = true,
+    .xorOut = 0x0000, .check = 0x4B37};
+
+const CRCModel CRC_MODEL_CRC32 =
+    {.width = 32, .poly = 0x04C11DB7, .init = 0xFFFFFFFF, .refIn = true, .refOut = true,
+    .xorOut = 0xFFFFFFFF, .check = 0xCBF43926};
+
+const CRCModel CRC_MODEL_CRC32C =
+    {.width = 32, .poly = 0x1EDC6F41, .init = 0xFFFFFFFF, .refIn = true, .refOut = true,
+    .xorOut = 0xFFFFFFFF, .check = 0xE3069283};
+
+// ***** Static Function Prototypes ********************************************
+
+static uint32_t Reflect(uint32_t value, uint8_t width);
+static uint32_t WidthMask(uint8_t width);
+static bool IsValid(const CRCModel *model, CRCMethod method, const uint32_t *table);
+static uint32_t ShiftBits(const CRCModel *model, uint32_t poly, uint32_t crc, uint8_t numBits);
+static uint32_t Process(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t Finish(CRC *self, uint32_t crc);
+static uint32_t Unfinish(CRC *self, uint32_t crc);
+static uint32_t MatrixTimes(const uint32_t *matrix, uint32_t vector);
+static void MatrixSquare(uint32_t *square, const uint32_t *matrix);
+static uint32_t ProcessBitwise(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t ProcessNibble(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t ProcessByte(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t ProcessSlice8(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length);
+
+// *****************************************************************************
+
+bool CRC_Init(CRC *self, const CRCModel *model, CRCMethod method, uint32_t *tableMemory)
+{
+    if(!IsValid(model, method, tableMemory))
+        return false;
+
+    if(method != CRC_METHOD_BITWISE)
+        CRC_GenerateTable(model, method, tableMemory);
+
+    return CRC_InitWithConstTable(self, model, method, tableMemory);
+}
+
+// *****************************************************************************
+
+bool CRC_InitWithConstTable(CRC *self, const CRCModel *model, CRCMethod method, const uint32_t *table)
+{
+    if(!IsValid(model, method, table))
+        return false;
+
+    self->private.model = model;
+    self->private.method = method;
+    self->private.table = table;
+
+    if(model->refIn)
+    {
+        self->private.poly = Reflect(model->poly, model->width);
+        self->private.init = Reflect(model->init, model->width);
+    }
+    else
+    {
+        self->private.poly = model->poly << (32 - model->width);
+        self->private.init = model->init << (32 - model->width);
+    }
+    self->private.reg = self->private.init;
+    self->private.updateFunc = NULL;
+    return true;
+}
+
+// *****************************************************************************
+
+void CRC_GenerateTable(const CRCModel *model, CRCMethod method, uint32_t *table)
+{
+    uint32_t poly;
+
+    if(model->refIn)
+        poly = Reflect(model->poly, model->width);
+    else
+        poly = model->poly << (32 - model->width);
+
+    if(method == CRC_METHOD_NIBBLE)
+    {
+        for(uint32_t i = 0; i < 16; i++)
+        {
+            uint32_t start = model->refIn ? i : (i << 28);
+            table[i] = ShiftBits(model, poly, start, 4);
+        }
+    }
+    else if(method == CRC_METHOD_BYTE || method == CRC_METHOD_SLICE8)
+    {
+        for(uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t start = model->refIn ? i : (i << 24);
+            table[i] = ShiftBits(model, poly, start, 8);
+        }
+
+        if(method == CRC_METHOD_SLICE8)
+        {
+            /* Each table is the one before it followed by a zero byte */
+            for(uint32_t k = 1; k < 8; k++)
+            {
+                for(uint32_t i = 0; i < 256; i++)
+                {
+                    uint32_t prev = table[(k - 1) * 256 + i];
+
+                    if(model->refIn)
+                        table[k * 256 + i] = (prev >> 8) ^ table[prev & 0xFF];
+                    else
+                        table[k * 256 + i] = (prev << 8) ^ table[prev >> 24];
+                }
+            }
+        }
+    }
+}
+
+// *****************************************************************************
+
+uint32_t CRC_Compute(CRC *self, const uint8_t *data, uint32_t length)
+{
+    return Finish(self, Process(self, self->private.init, data, length));
+}
+
+// *****************************************************************************
+
+void CRC_Reset(CRC *self)
+{
+    self->private.reg = self->private.init;
+}
+
+// *****************************************************************************
+
+void CRC_Update(CRC *self, const uint8_t *data, uint32_t length)
+{
+    self->private.reg = Process(self, self->private.reg, data, length);
+}
+
+// *****************************************************************************
+
+uint32_t CRC_Final(CRC *self)
+{
+    uint32_t result = Finish(self, self->private.reg);
+
+    // Get ready for the next message
+    self->private.reg = self->private.init;
+    return result;
+}
+
+// *****************************************************************************
+
+void CRC_SetUpdateFunction(CRC *self, CRCUpdateFunc Function)
+{
+    self->private.updateFunc = Function;
+}
+
+// *****************************************************************************
+
+uint32_t CRC_Combine(CRC *self, uint32_t crcA, uint32_t crcB, uint64_t lengthB)
+{
+    uint32_t even[32];
+    uint32_t odd[32];
+    uint32_t regA = Unfinish(self, crcA) ^ self->private.init;
+    uint32_t regB = Unfinish(self, crcB);
+
+    if(lengthB == 0)
+        return crcA;
+
+    /* Make the matrix for one zero bit. Each column is what happens to one 
+    bit of the register. */
+    for(uint32_t i = 0; i < 32; i++)
+    {
+        uint32_t bit = 1UL << i;
+
+        if(self->private.model->refIn)
+            odd[i] = (bit & 1) ? (bit >> 1) ^ self->private.poly : (bit >> 1);
+        else
+            odd[i] = (bit & 0x80000000UL) ? (bit << 1) ^ self->private.poly : (bit << 1);
+    }
+
+    MatrixSquare(even, odd); // two zero bits
+    MatrixSquare(odd, even); // four zero bits
+
+    /* The first time through, "even" becomes one zero byte. After that, each 
+    square doubles it. Apply the ones that match the bits in the length. */
+    do
+    {
+        MatrixSquare(even, odd);
+        if(lengthB & 1)
+            regA = MatrixTimes(even, regA);
+        lengthB >>= 1;
+
+        if(lengthB == 0)
+            break;
+
+        MatrixSquare(odd, even);
+        if(lengthB & 1)
+            regA = MatrixTimes(odd, regA);
+        lengthB >>= 1;
+    } while(lengthB != 0);
+
+    return Finish(self, regA ^ regB);
+}
+
+// *****************************************************************************
+
+static uint32_t Process(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    if(self->private.updateFunc)
+        return self->private.updateFunc(crc, data, length);
+
+    switch(self->private.method)
+    {
+        case CRC_METHOD_NIBBLE:
+            return ProcessNibble(self, crc, data, length);
+        case CRC_METHOD_BYTE:
+            return ProcessByte(self, crc, data, length);
+        case CRC_METHOD_SLICE8:
+            return ProcessSlice8(self, crc, data, length);
+        case CRC_METHOD_BITWISE:
+        default:
+            return ProcessBitwise(self, crc, data, length);
+    }
+}
+
+// *****************************************************************************
+
+static uint32_t Finish(CRC *self, uint32_t crc)
+{
+    const CRCModel *model = self->private.model;
+
+    /* Put the register back to a normal number, then reflect it if needed */
+    if(!model->refIn)
+        crc >>= (32 - model->width);
+
+    if(model->refIn != model->refOut)
+        crc = Reflect(crc, model->width);
+
+    return (crc ^ model->xorOut) & WidthMask(model->width);
+}
+
+// *****************************************************************************
+
+static uint32_t Unfinish(CRC *self, uint32_t crc)
+{
+    const CRCModel *model = self->private.model;
+
+    // Do everything in Finish backwards
+    crc = (crc ^ model->xorOut) & WidthMask(model->width);
+
+    if(model->refIn != model->refOut)
+        crc = Reflect(crc, model->width);
+
+    if(!model->refIn)
+        crc <<= (32 - model->width);
+
+    return crc;
+}
+
+// *****************************************************************************
+
+static uint32_t MatrixTimes(const uint32_t *matrix, uint32_t vector)
+{
+    uint32_t result = 0;
+
+    while(vector)
+    {
+        if(vector & 1)
+            result ^= *matrix;
+        vector >>= 1;
+        matrix++;
+    }
+    return result;
+}
+
+// *****************************************************************************
+
+static void MatrixSquare(uint32_t *square, const uint32_t *matrix)
+{
+    for(uint32_t i = 0; i < 32; i++)
+        square[i] = MatrixTimes(matrix, matrix[i]);
+}
+
+// *****************************************************************************
+
+static uint32_t Reflect(uint32_t value, uint8_t width)
+{
+    uint32_t result = 0;
+
+    for(uint8_t i = 0; i < width; i++)
+    {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+// *****************************************************************************
+
+static uint32_t WidthMask(uint8_t width)
+{
+    return 0xFFFFFFFFUL >> (32 - width);
+}
+
+// *****************************************************************************
+
+static bool IsValid(const CRCModel *model, CRCMethod method, const uint32_t *table)
+{
+    if(model == NULL || model->width < 1 || model->width > 32)
+        return false;
+
+    if(method > CRC_METHOD_SLICE8)
+        return false;
+
+    if(method != CRC_METHOD_BITWISE && table == NULL)
+        return false;
+
+    return true;
+}
+
+// *****************************************************************************
+
+static uint32_t ShiftBits(const CRCModel *model, uint32_t poly, uint32_t crc, uint8_t numBits)
+{
+    for(uint8_t i = 0; i < numBits; i++)
+    {
+        if(model->refIn)
+            crc = (crc & 1) ? (crc >> 1) ^ poly : (crc >> 1);
+        else
+            crc = (crc & 0x80000000UL) ? (crc << 1) ^ poly : (crc << 1);
+    }
+    return crc;
+}
+
+// *****************************************************************************
+
+static uint32_t ProcessBitwise(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    const CRCModel *model = self->private.model;
+
+    for(uint32_t i = 0; i < length; i++)
+    {
+        if(model->refIn)
+            crc ^= data[i];
+        else
+            crc ^= (uint32_t)data[i] << 24;
+
+        crc = ShiftBits(model, self->private.poly, crc, 8);
+    }
+    return crc;
+}
+
+// *****************************************************************************
+
+static uint32_t ProcessNibble(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    const uint32_t *table = self->private.table;
+
+    if(self->private.model->refIn)
+    {
+        /* Low nibble first */
+        for(uint32_t i = 0; i < length; i++)
+        {
+            crc = (crc >> 4) ^ table[(crc ^ data[i]) & 0x0F];
+            crc = (crc >> 4) ^ table[(crc ^ (data[i] >> 4)) & 0x0F];
+        }
+    }
+    else
+    {
+        /* High nibble first */
+        for(uint32_t i = 0; i < length; i++)
+        {
+            crc = (crc << 4) ^ table[(crc >> 28) ^ (data[i] >> 4)];
+            crc = (crc << 4) ^ table[(crc >> 28) ^ (data[i] & 0x0F)];
+        }
+    }
+    return crc;
+}
+
+// *****************************************************************************
+
+static uint32_t ProcessByte(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    const uint32_t *table = self->private.table;
+
+    if(self->private.model->refIn)
+    {
+        for(uint32_t i = 0; i < length; i++)
+            crc = (crc >> 8) ^ table[(crc ^ data[i]) & 0xFF];
+    }
+    else
+    {
+        for(uint32_t i = 0; i < length; i++)
+            crc = (crc << 8) ^ table[(crc >> 24) ^ data[i]];
+    }
+    return crc;
+}
+
+// *****************************************************************************
+
+static uint32_t ProcessSlice8(CRC *self, uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    const uint32_t *t = self->private.table;
+
+    if(self->private.model->refIn)
+    {
+        while(length >= 8)
+        {
+            uint32_t lo = crc ^ ((uint32_t)data[0] | (uint32_t)data[1] << 8 |
+                (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24);
+
+            crc = t[7 * 256 + (lo & 0xFF)] ^ t[6 * 256 + ((lo >> 8) & 0xFF)] ^
+                t[5 * 256 + ((lo >> 16) & 0xFF)] ^ t[4 * 256 + (lo >> 24)] ^
+                t[3 * 256 + data[4]] ^ t[2 * 256 + data[5]] ^
+                t[1 * 256 + data[6]] ^ t[data[7]];
+
+            data += 8;
+            length -= 8;
+        }
+    }
+    else
+    {
+        while(length >= 8)
+        {
+            uint32_t hi = crc ^ ((uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 |
+                (uint32_t)data[2] << 8 | (uint32_t)data[3]);
+
+            crc = t[7 * 256 + (hi >> 24)] ^ t[6 * 256 + ((hi >> 16) & 0xFF)] ^
+                t[5 * 256 + ((hi >> 8) & 0xFF)] ^ t[4 * 256 + (hi & 0xFF)] ^
+                t[3 * 256 + data[4]] ^ t[2 * 256 + data[5]] ^
+                t[1 * 256 + data[6]] ^ t[data[7]];
+
+            data += 8;
+            length -= 8;
+        }
+    }
+
+    /* Table 0 is the regular byte table, so finish up one byte at a time */
+    return ProcessByte(self, crc, data, length);
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,307 @@
+/***************************************************************************//**
+ * @brief Parameterized CRC Library Header File
+ * 
+ * @file CRC.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * @date 10/16/26  Added streaming update/final functions
+ * @date 10/16/26  Added update function hook for hardware CRC
+ * @date 10/16/26  Added CRC_Combine
+ * 
+ * @details
+ *      Every CRC out there can be described with six numbers. This is called
+ * the Rocksoft model, from Ross Williams' "A Painless Guide to CRC Error
+ * Detection Algorithms". The numbers are the width in bits, the polynomial,
+ * the initial value of the register, whether each input byte is reflected
+ * (LSB first), whether the final result is reflected, and a value that is
+ * XOR'd with the result at the end. Instead of writing a new bit by bit
+ * routine for every product, you fill in a CRCModel and hand it to a CRC
+ * object. The most common ones are already defined below. The check value is
+ * what you should get when you run the ASCII string "123456789" through it.
+ * 
+ * There are four ways to compute the CRC, from smallest to fastest:
+ * 
+ *      CRC_METHOD_BITWISE   no table. One bit at a time.
+ *      CRC_METHOD_NIBBLE    16 entry table. Four bits at a time. Good for
+ *                           micros where flash is tight.
+ *      CRC_METHOD_BYTE      256 entry table. One byte at a time.
+ *      CRC_METHOD_SLICE8    8 x 256 entry table. Eight bytes at a time. Meant
+ *                           for host machines with a big cache.
+ * 
+ * Just like my other libraries, you provide the memory. If you give CRC_Init
+ * an array, the table is built at run time. If you would rather have the
+ * table in flash, run the GenerateCRCTable program to print a const array
+ * and pass that to CRC_InitWithConstTable instead. Either way, the table has
+ * to be built for the same model and method that you are using. The table
+ * entries are always 32-bit. CRC's that are not reflected are kept shifted
+ * up to the top of a 32-bit register, so the same code works for any width
+ * from 1 to 32 bits.
+ * 
+ * Some processors can do certain CRC's in hardware. A faster update function 
+ * for the register can be plugged in with CRC_SetUpdateFunction. CRC_x86.c 
+ * uses this for CRC-32 and CRC-32C on x86-64.
+ * 
+ * If you have the CRC of two pieces of data and the length of the second 
+ * piece, CRC_Combine can give you the CRC of both pieces back to back 
+ * without looking at the data again. This is what lets CRC_Parallel.c split 
+ * a big buffer up between threads.
+ * 
+ * @section example_code Example Code
+ * 
+ *      CRC crc;
+ *      uint32_t table[CRC_BYTE_TABLE_SIZE];
+ * 
+ *      CRC_Init(&crc, &CRC_MODEL_CRC16_MODBUS, CRC_METHOD_BYTE, table);
+ *      uint16_t result = CRC_Compute(&crc, frame, frameLength);
+ * 
+ *      // Or a piece at a time
+ *      CRC_Update(&crc, firstPiece, firstLength);
+ *      CRC_Update(&crc, secondPiece, secondLength);
+ *      result = CRC_Final(&crc);
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ***** Defines ***************************************************************
+
+/* Number of uint32_t entries each method needs for its table */
+#define CRC_NIBBLE_TABLE_SIZE   16
+#define CRC_BYTE_TABLE_SIZE     256
+#define CRC_SLICE8_TABLE_SIZE   (8 * 256)
+
+// ***** Global Variables ******************************************************
+
+typedef enum CRCMethodTag
+{
+    CRC_METHOD_BITWISE,
+    CRC_METHOD_NIBBLE,
+    CRC_METHOD_BYTE,
+    CRC_METHOD_SLICE8,
+} CRCMethod;
+
+typedef struct CRCModelTag
+{
+    uint8_t width;
+    uint32_t poly;
+    uint32_t init;
+    bool refIn;
+    bool refOut;
+    uint32_t xorOut;
+    uint32_t check;
+} CRCModel;
+
+/**
+ * width  number of bits in the CRC, from 1 to 32
+ * 
+ * poly  the polynomial, written normally (MSB first) without the top bit
+ * 
+ * init  the starting value of the register, written normally
+ * 
+ * refIn  true if each byte is processed LSB first
+ * 
+ * refOut  true if the result is reflected before the final XOR
+ * 
+ * xorOut  value XOR'd with the result at the end
+ * 
+ * check  the result for the ASCII string "123456789". Used for testing
+ */
+
+/* A function that runs data through the register. The register is in the 
+same form the table methods use. Make your function pointer follow this 
+format */
+typedef uint32_t (*CRCUpdateFunc)(uint32_t reg, const uint8_t *data, uint32_t length);
+
+typedef struct CRCTag
+{
+    struct
+    {
+        const CRCModel *model;
+        CRCMethod method;
+        const uint32_t *table;
+        uint32_t poly;
+        uint32_t init;
+        uint32_t reg;
+        CRCUpdateFunc updateFunc;
+    } private;
+} CRC;
+
+/**
+ * The variables below should be treated as private. You should only access
+ * them with the use of a function.
+ * 
+ * model  pointer to the model this object was set up for
+ * 
+ * method  which of the four methods is used
+ * 
+ * table  pointer to the table. NULL for the bitwise method
+ * 
+ * poly  the polynomial, either reflected or shifted to the top of the register
+ * 
+ * init  the initial value, either reflected or shifted to the top
+ * 
+ * reg  the running register for CRC_Update
+ * 
+ * updateFunc  if not NULL, used instead of the method
+ */
+
+/* Some common models. Check values are from the CRC RevEng catalogue */
+extern const CRCModel CRC_MODEL_CRC8;
+extern const CRCModel CRC_MODEL_CRC8_MAXIM;
+extern const CRCModel CRC_MODEL_CRC16_CCITT_FALSE;
+extern const CRCModel CRC_MODEL_CRC16_KERMIT;
+extern const CRCModel CRC_MODEL_CRC16_XMODEM;
+extern const CRCModel CRC_MODEL_CRC16_MODBUS;
+extern const CRCModel CRC_MODEL_CRC32;
+extern const CRCModel CRC_MODEL_CRC32C;
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initializes a CRC object and builds its table
+ * 
+ * The size of the table depends on the method. Use CRC_NIBBLE_TABLE_SIZE,
+ * CRC_BYTE_TABLE_SIZE, or CRC_SLICE8_TABLE_SIZE. For the bitwise method, the
+ * table can be NULL.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param model  pointer to the model. It must stay around, so make it const
+ * 
+ * @param method  which method to use
+ * 
+ * @param tableMemory  pointer to an array of uint32_t for the table
+ * 
+ * @return true if the model and table are valid
+ */
+bool CRC_Init(CRC *self, const CRCModel *model, CRCMethod method, uint32_t *tableMemory);
+
+/***************************************************************************//**
+ * @brief Initializes a CRC object with a table that was already made
+ * 
+ * Use this with a table that was printed by the GenerateCRCTable program or
+ * built with CRC_GenerateTable. It must match the model and method.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param model  pointer to the model
+ * 
+ * @param method  which method to use
+ * 
+ * @param table  pointer to the table
+ * 
+ * @return true if the model and table are valid
+ */
+bool CRC_InitWithConstTable(CRC *self, const CRCModel *model, CRCMethod method, const uint32_t *table);
+
+/***************************************************************************//**
+ * @brief Fill in a table for a model and method
+ * 
+ * @param model  pointer to the model
+ * 
+ * @param method  the method the table will be used with
+ * 
+ * @param table  pointer to an array of uint32_t big enough for the method
+ */
+void CRC_GenerateTable(const CRCModel *model, CRCMethod method, uint32_t *table);
+
+/***************************************************************************//**
+ * @brief Compute the CRC of an array
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param data  pointer to the data
+ * 
+ * @param length  number of bytes
+ * 
+ * @return uint32_t  the CRC. Only the lower "width" bits are used
+ */
+uint32_t CRC_Compute(CRC *self, const uint8_t *data, uint32_t length);
+
+/***************************************************************************//**
+ * @brief Start a new message
+ * 
+ * CRC_Init and CRC_Final already do this for you. Only call this if you 
+ * need to throw away a message halfway through.
+ * 
+ * @param self  pointer to the CRC that you are using
+ */
+void CRC_Reset(CRC *self);
+
+/***************************************************************************//**
+ * @brief Add the next piece of a message to the CRC
+ * 
+ * The pieces can be any length and don't have to be next to each other in 
+ * memory. The result is the same as if CRC_Compute was called on all of it.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param data  pointer to the data
+ * 
+ * @param length  number of bytes
+ */
+void CRC_Update(CRC *self, const uint8_t *data, uint32_t length);
+
+/***************************************************************************//**
+ * @brief Get the CRC of everything passed to CRC_Update
+ * 
+ * The CRC starts over for the next message after this is called.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @return uint32_t  the CRC. Only the lower "width" bits are used
+ */
+uint32_t CRC_Final(CRC *self);
+
+/***************************************************************************//**
+ * @brief Use a different function to update the register
+ * 
+ * This is how a hardware CRC is plugged in. The function must give exactly 
+ * the same answer as the method it replaces. Set it to NULL to go back to 
+ * the method. CRC_Init clears it.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param Function  format: uint32_t SomeFunction(uint32_t reg, 
+ *                  const uint8_t *data, uint32_t length)
+ */
+void CRC_SetUpdateFunction(CRC *self, CRCUpdateFunc Function);
+
+/***************************************************************************//**
+ * @brief Get the CRC of two messages back to back from their CRC's
+ * 
+ * Running zeros through a CRC register is a linear operation, so it can be 
+ * written as a 32 x 32 bit matrix. Squaring the matrix doubles the number of 
+ * zeros, so the work only grows with log2(lengthB).
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param crcA  the CRC of the first message
+ * 
+ * @param crcB  the CRC of the second message
+ * 
+ * @param lengthB  length of the second message in bytes
+ * 
+ * @return uint32_t  the CRC of the first message followed by the second
+ */
+uint32_t CRC_Combine(CRC *self, uint32_t crcA, uint32_t crcB, uint64_t lengthB);
+
+#endif  /* CRC_H */
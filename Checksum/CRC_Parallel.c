@@ -0,0 +1,122 @@
+/***************************************************************************//**
+ * @brief Multi-Threaded CRC for Large Buffers
+ * 
+ * @file CRC_Parallel.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See CRC_Parallel.h. Each thread gets its own copy of the CRC object, 
+ * so the threads never touch the same register. The table is shared, but 
+ * it's only read. The pieces are all the same size except for the last one, 
+ * which also picks up whatever is left over.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "CRC_Parallel.h"
+#include <pthread.h>
+
+// ***** Defines ***************************************************************
+
+/* CRC_Update takes a 32-bit length, so anything bigger is fed in steps */
+#define CRC_PARALLEL_STEP   0x40000000UL
+
+// ***** Global Variables ******************************************************
+
+typedef struct CRCParallelJobTag
+{
+    CRC crc;
+    const uint8_t *data;
+    uint64_t length;
+    uint32_t result;
+} CRCParallelJob;
+
+// ***** Static Function Prototypes ********************************************
+
+static void *Work(void *arg);
+
+// *****************************************************************************
+
+uint32_t CRC_Parallel_Compute(CRC *self, const uint8_t *data, uint64_t length, uint32_t numThreads)
+{
+    CRCParallelJob jobs[CRC_PARALLEL_MAX_THREADS];
+    pthread_t threads[CRC_PARALLEL_MAX_THREADS];
+    bool started[CRC_PARALLEL_MAX_THREADS];
+
+    if(numThreads > CRC_PARALLEL_MAX_THREADS)
+        numThreads = CRC_PARALLEL_MAX_THREADS;
+
+    if(numThreads > length / CRC_PARALLEL_MIN_CHUNK)
+        numThreads = length / CRC_PARALLEL_MIN_CHUNK;
+
+    if(numThreads == 0)
+        numThreads = 1;
+
+    uint64_t chunk = length / numThreads;
+
+    for(uint32_t i = 0; i < numThreads; i++)
+    {
+        jobs[i].crc = *self;
+        jobs[i].data = data + chunk * i;
+        jobs[i].length = (i == numThreads - 1) ? length - chunk * i : chunk;
+        started[i] = false;
+    }
+
+    /* The calling thread takes the first piece itself, so one thread means 
+    no threads get started at all */
+    for(uint32_t i = 1; i < numThreads; i++)
+    {
+        if(pthread_create(&threads[i], NULL, Work, &jobs[i]) == 0)
+            started[i] = true;
+    }
+
+    Work(&jobs[0]);
+    uint32_t result = jobs[0].result;
+
+    for(uint32_t i = 1; i < numThreads; i++)
+    {
+        if(started[i])
+            pthread_join(threads[i], NULL);
+        else
+            Work(&jobs[i]);
+
+        result = CRC_Combine(self, result, jobs[i].result, jobs[i].length);
+    }
+    return result;
+}
+
+// *****************************************************************************
+
+static void *Work(void *arg)
+{
+    CRCParallelJob *job = arg;
+    const uint8_t *data = job->data;
+    uint64_t length = job->length;
+
+    CRC_Reset(&job->crc);
+
+    while(length > 0)
+    {
+        uint32_t step = (length > CRC_PARALLEL_STEP) ? CRC_PARALLEL_STEP : (uint32_t)length;
+        CRC_Update(&job->crc, data, step);
+        data += step;
+        length -= step;
+    }
+
+    job->result = CRC_Final(&job->crc);
+    return NULL;
+}
+
+/*
+ End of File
+ */
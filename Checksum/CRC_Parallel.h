@@ -0,0 +1,81 @@
+/***************************************************************************//**
+ * @brief Multi-Threaded CRC for Large Buffers Header
+ * 
+ * @file CRC_Parallel.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      For multi-gigabyte files like firmware images and captures, one core 
+ * can't keep up with the disk. This cuts the buffer into one piece per 
+ * thread, has each thread find the CRC of its own piece, and then glues the 
+ * CRC's together in order with CRC_Combine. The answer is exactly the same 
+ * as CRC_Compute on the whole thing.
+ * 
+ * This is meant for host machines. It uses POSIX threads, so link with 
+ * -pthread. The threads are started and joined inside the function. The CRC 
+ * object can be set up any way you like, including with CRC_x86_Init. It is 
+ * only read, not changed, so its streaming register is left alone.
+ * 
+ * @section example_code Example Code
+ * 
+ *      CRC crc;
+ *      uint32_t table[CRC_SLICE8_TABLE_SIZE];
+ * 
+ *      CRC_Init(&crc, &CRC_MODEL_CRC32, CRC_METHOD_SLICE8, table);
+ *      uint32_t result = CRC_Parallel_Compute(&crc, image, imageLength, 8);
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef CRC_PARALLEL_H
+#define CRC_PARALLEL_H
+
+#include "CRC.h"
+
+// ***** Defines ***************************************************************
+
+#define CRC_PARALLEL_MAX_THREADS    64
+
+/* Each thread gets at least this many bytes. Below that, starting a thread 
+takes longer than just doing the work. */
+#define CRC_PARALLEL_MIN_CHUNK      (256UL * 1024UL)
+
+// ***** Global Variables ******************************************************
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Compute the CRC of a big buffer with more than one thread
+ * 
+ * The number of threads is limited to CRC_PARALLEL_MAX_THREADS and to one 
+ * per CRC_PARALLEL_MIN_CHUNK bytes. With one thread, it's done on the calling 
+ * thread. If a thread can't be started, the calling thread does that piece.
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param data  pointer to the data
+ * 
+ * @param length  number of bytes
+ * 
+ * @param numThreads  how many threads to use
+ * 
+ * @return uint32_t  the CRC, the same as CRC_Compute would give
+ */
+uint32_t CRC_Parallel_Compute(CRC *self, const uint8_t *data, uint64_t length, uint32_t numThreads);
+
+#endif  /* CRC_PARALLEL_H */
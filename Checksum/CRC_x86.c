@@ -0,0 +1,370 @@
+/***************************************************************************//**
+ * @brief Hardware CRC for x86-64
+ * 
+ * @file CRC_x86.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See CRC_x86.h. Both hardware functions work on the same reflected
+ * register that the table methods use, so they can be swapped in and out
+ * in the middle of a message.
+ * 
+ * For CRC-32C, the data is cut into three lanes that are each run through
+ * the crc32 instruction at the same time. The second and third lanes start
+ * from zero. To put them back together, the first lane's CRC is "shifted"
+ * as if it had been run through as many zero bytes as there are in a lane,
+ * and then the next lane's CRC is XOR'd in. Running zeros through a CRC
+ * register is linear, so the shift can be done with four table lookups, one
+ * for each byte of the register. The tables are made once by running each
+ * byte value through a lane's worth of zeros with the instruction itself.
+ * This is the same trick Mark Adler uses in his crc32c code.
+ * 
+ * For CRC-32, four 16 byte blocks are folded forward 64 bytes at a time with
+ * carry-less multiplies. At the end they are folded down to one block, down
+ * to 64 bits, and then a Barrett reduction gets the 32-bit CRC. The
+ * constants are the ones for the reflected CRC-32 polynomial from the Intel
+ * paper, and the same ones the Linux kernel uses. Anything that is shorter
+ * than 64 bytes or left over at the end uses a byte table.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "CRC_x86.h"
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC_X86_ENABLED     1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define CRC_X86_ENABLED     0
+#endif
+
+// ***** Defines ***************************************************************
+
+/* Lane sizes for the three way CRC-32C. Big lanes for big data, and small
+lanes so that medium sized data still gets some of the speed up. */
+#define CRC32C_LONG     8192
+#define CRC32C_SHORT    256
+
+/* Below this, the folding isn't worth it */
+#define CRC32_FOLD_MIN  64
+
+// ***** Global Variables ******************************************************
+
+#if CRC_X86_ENABLED
+static uint32_t crc32cLong[4][256];
+static uint32_t crc32cShort[4][256];
+static uint32_t crc32Table[256];
+static bool tablesReady = false;
+#endif
+
+// ***** Static Function Prototypes ********************************************
+
+#if CRC_X86_ENABLED
+static void MakeTables(void);
+static uint32_t Shift(uint32_t table[4][256], uint32_t crc);
+static uint32_t UpdateCRC32CSingle(uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t UpdateCRC32C(uint32_t reg, const uint8_t *data, uint32_t length);
+static uint32_t Fold(uint32_t crc, const uint8_t *data, uint32_t length);
+static uint32_t UpdateCRC32(uint32_t reg, const uint8_t *data, uint32_t length);
+#endif
+
+// *****************************************************************************
+
+bool CRC_x86_Init(CRC *self, const CRCModel *model, uint32_t *tableMemory)
+{
+    if(!CRC_Init(self, model, CRC_METHOD_SLICE8, tableMemory))
+        return false;
+
+#if CRC_X86_ENABLED
+    if(model->width != 32 || !model->refIn || !model->refOut)
+        return true;
+
+    if(model->poly == CRC_MODEL_CRC32C.poly && CRC_x86_HasSSE42())
+    {
+        MakeTables();
+        CRC_SetUpdateFunction(self, UpdateCRC32C);
+    }
+    else if(model->poly == CRC_MODEL_CRC32.poly && CRC_x86_HasPCLMUL())
+    {
+        MakeTables();
+        CRC_SetUpdateFunction(self, UpdateCRC32);
+    }
+#endif
+    return true;
+}
+
+// *****************************************************************************
+
+CRCx86Path CRC_x86_GetPath(CRC *self)
+{
+#if CRC_X86_ENABLED
+    if(self->private.updateFunc == UpdateCRC32C)
+        return CRC_X86_PATH_SSE42;
+    else if(self->private.updateFunc == UpdateCRC32)
+        return CRC_X86_PATH_PCLMUL;
+#else
+    (void)self;
+#endif
+    return CRC_X86_PATH_TABLE;
+}
+
+// *****************************************************************************
+
+bool CRC_x86_HasSSE42(void)
+{
+#if CRC_X86_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+
+    if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2))
+        return true;
+#endif
+    return false;
+}
+
+// *****************************************************************************
+
+bool CRC_x86_HasPCLMUL(void)
+{
+#if CRC_X86_ENABLED
+    unsigned int eax, ebx, ecx, edx;
+
+    /* The folding also uses an SSE4.1 instruction at the end */
+    if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL) && (ecx & bit_SSE4_1))
+        return true;
+#endif
+    return false;
+}
+
+#if CRC_X86_ENABLED
+
+// *****************************************************************************
+
+static void MakeTables(void)
+{
+    static const uint8_t zeros[CRC32C_LONG];
+
+    if(tablesReady)
+        return;
+
+    CRC_GenerateTable(&CRC_MODEL_CRC32, CRC_METHOD_BYTE, crc32Table);
+
+    if(CRC_x86_HasSSE42())
+    {
+        for(uint32_t k = 0; k < 4; k++)
+        {
+            for(uint32_t b = 0; b < 256; b++)
+            {
+                uint32_t start = b << (8 * k);
+                crc32cLong[k][b] = UpdateCRC32CSingle(start, zeros, CRC32C_LONG);
+                crc32cShort[k][b] = UpdateCRC32CSingle(start, zeros, CRC32C_SHORT);
+            }
+        }
+    }
+    tablesReady = true;
+}
+
+// *****************************************************************************
+
+static uint32_t Shift(uint32_t table[4][256], uint32_t crc)
+{
+    return table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^
+        table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24];
+}
+
+// *****************************************************************************
+
+__attribute__((target("sse4.2")))
+static uint32_t UpdateCRC32CSingle(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    uint64_t crc64 = crc;
+    uint64_t word;
+
+    while(length >= 8)
+    {
+        memcpy(&word, data, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        length -= 8;
+    }
+
+    crc = (uint32_t)crc64;
+    while(length > 0)
+    {
+        crc = _mm_crc32_u8(crc, *data++);
+        length--;
+    }
+    return crc;
+}
+
+// *****************************************************************************
+
+__attribute__((target("sse4.2")))
+static uint32_t UpdateCRC32C(uint32_t reg, const uint8_t *data, uint32_t length)
+{
+    uint64_t word0, word1, word2;
+
+    while(length >= 3 * CRC32C_LONG)
+    {
+        uint64_t crc0 = reg, crc1 = 0, crc2 = 0;
+        const uint8_t *end = data + CRC32C_LONG;
+
+        do
+        {
+            memcpy(&word0, data, 8);
+            memcpy(&word1, data + CRC32C_LONG, 8);
+            memcpy(&word2, data + 2 * CRC32C_LONG, 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += 8;
+        } while(data < end);
+
+        reg = Shift(crc32cLong, (uint32_t)crc0) ^ (uint32_t)crc1;
+        reg = Shift(crc32cLong, reg) ^ (uint32_t)crc2;
+        data += 2 * CRC32C_LONG;
+        length -= 3 * CRC32C_LONG;
+    }
+
+    while(length >= 3 * CRC32C_SHORT)
+    {
+        uint64_t crc0 = reg, crc1 = 0, crc2 = 0;
+        const uint8_t *end = data + CRC32C_SHORT;
+
+        do
+        {
+            memcpy(&word0, data, 8);
+            memcpy(&word1, data + CRC32C_SHORT, 8);
+            memcpy(&word2, data + 2 * CRC32C_SHORT, 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += 8;
+        } while(data < end);
+
+        reg = Shift(crc32cShort, (uint32_t)crc0) ^ (uint32_t)crc1;
+        reg = Shift(crc32cShort, reg) ^ (uint32_t)crc2;
+        data += 2 * CRC32C_SHORT;
+        length -= 3 * CRC32C_SHORT;
+    }
+
+    return UpdateCRC32CSingle(reg, data, length);
+}
+
+// *****************************************************************************
+
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t Fold(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    /* Constants for the reflected CRC-32 polynomial. k1 and k2 fold 64 bytes
+    forward, k3 and k4 fold 16 bytes, k5 folds 64 bits down to 32, and the
+    last pair is the polynomial and mu for the Barrett reduction. */
+    const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+    const __m128i k5 = _mm_set_epi64x(0, 0x0163CD6124);
+    const __m128i polyMu = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x1, x2, x3, x4, t1, t2, t3, t4;
+
+    x1 = _mm_loadu_si128((const __m128i *)(data + 0));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 16));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 32));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    data += 64;
+    length -= 64;
+
+    // Fold four blocks at a time
+    while(length >= 64)
+    {
+        t1 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        t2 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        t3 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        t4 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, t1), _mm_loadu_si128((const __m128i *)(data + 0)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, t2), _mm_loadu_si128((const __m128i *)(data + 16)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, t3), _mm_loadu_si128((const __m128i *)(data + 32)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, t4), _mm_loadu_si128((const __m128i *)(data + 48)));
+        data += 64;
+        length -= 64;
+    }
+
+    // Fold the four blocks into one
+    t1 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), t1);
+    t1 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), t1);
+    t1 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), t1);
+
+    // Any 16 byte blocks that are left
+    while(length >= 16)
+    {
+        t1 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)data)), t1);
+        data += 16;
+        length -= 16;
+    }
+
+    // 128 bits down to 64
+    t1 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), t1);
+
+    // 64 bits down to 32, plus 32 zero bits
+    t1 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5, 0x00);
+    x1 = _mm_xor_si128(x1, t1);
+
+    // Barrett reduction down to the 32-bit CRC
+    t1 = _mm_and_si128(x1, mask32);
+    t1 = _mm_clmulepi64_si128(t1, polyMu, 0x10);
+    t1 = _mm_and_si128(t1, mask32);
+    t1 = _mm_clmulepi64_si128(t1, polyMu, 0x00);
+    x1 = _mm_xor_si128(x1, t1);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+// *****************************************************************************
+
+static uint32_t UpdateCRC32(uint32_t reg, const uint8_t *data, uint32_t length)
+{
+    if(length >= CRC32_FOLD_MIN)
+    {
+        uint32_t numFolded = length & ~15UL;
+        reg = Fold(reg, data, numFolded);
+        data += numFolded;
+        length -= numFolded;
+    }
+
+    for(uint32_t i = 0; i < length; i++)
+        reg = (reg >> 8) ^ crc32Table[(reg ^ data[i]) & 0xFF];
+
+    return reg;
+}
+
+#endif  /* CRC_X86_ENABLED */
+
+/*
+ End of File
+ */
@@ -0,0 +1,110 @@
+/***************************************************************************//**
+ * @brief Hardware CRC for x86-64 Header
+ * 
+ * @file CRC_x86.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      This is the x86 specific piece of the CRC library. Newer x86
+ * processors have two instructions that can make a CRC much faster than any
+ * table. SSE4.2 added a crc32 instruction, but it only does the CRC-32C
+ * polynomial (the one used by iSCSI, ext4, and others). It takes three
+ * cycles to finish but a new one can start every cycle, so the data is cut
+ * into three lanes that are run side by side and glued back together at the
+ * end. For the regular CRC-32 (Ethernet, zip, PNG), there is PCLMULQDQ,
+ * which multiplies two 64-bit numbers without carries. With it, 64 bytes at
+ * a time can be "folded" into the CRC. This follows the Intel paper "Fast
+ * CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+ * 
+ * CRC_x86_Init sets up a CRC object with a slicing-by-8 table just like
+ * CRC_Init would. Then it uses CPUID to see what the processor has. If the
+ * model is CRC-32C or CRC-32 and the instruction is there, the hardware
+ * function is plugged into the CRC object. Otherwise it just uses the table.
+ * You use the regular CRC functions after that. The compiler doesn't need
+ * any special flags. Only the functions that use the instructions are built
+ * for them, and they are only called if the processor has them.
+ * 
+ * Call CRC_x86_Init before starting any threads that use it, since the first
+ * call fills in a couple of shared tables. Requires GCC or Clang.
+ * 
+ * @section example_code Example Code
+ * 
+ *      CRC crc;
+ *      uint32_t table[CRC_SLICE8_TABLE_SIZE];
+ * 
+ *      CRC_x86_Init(&crc, &CRC_MODEL_CRC32C, table);
+ *      uint32_t result = CRC_Compute(&crc, data, length);
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef CRC_X86_H
+#define CRC_X86_H
+
+#include "CRC.h"
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+typedef enum CRCx86PathTag
+{
+    CRC_X86_PATH_TABLE,
+    CRC_X86_PATH_SSE42,
+    CRC_X86_PATH_PCLMUL,
+} CRCx86Path;
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Initializes a CRC object and uses hardware if it can
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @param model  pointer to the model
+ * 
+ * @param tableMemory  array of CRC_SLICE8_TABLE_SIZE uint32_t for the table
+ * 
+ * @return true if the model and table are valid
+ */
+bool CRC_x86_Init(CRC *self, const CRCModel *model, uint32_t *tableMemory);
+
+/***************************************************************************//**
+ * @brief Find out which path a CRC object set up by CRC_x86_Init is using
+ * 
+ * @param self  pointer to the CRC that you are using
+ * 
+ * @return CRCx86Path  table, SSE4.2, or PCLMUL
+ */
+CRCx86Path CRC_x86_GetPath(CRC *self);
+
+/***************************************************************************//**
+ * @brief Does this processor have the SSE4.2 crc32 instruction
+ * 
+ * @return true if it does
+ */
+bool CRC_x86_HasSSE42(void);
+
+/***************************************************************************//**
+ * @brief Does this processor have the PCLMULQDQ instruction
+ * 
+ * @return true if it does
+ */
+bool CRC_x86_HasPCLMUL(void);
+
+#endif  /* CRC_X86_H */
@@ -6,6 +6,9 @@
  * @author Matthew Spinks <https://github.com/mspinksosu>
  * 
  * @date 2/25/23   Original creation
+ * @date 10/16/26  Added streaming init/update/final functions
+ * @date 10/16/26  Added Internet checksum
+ * @date 10/16/26  Added Fletcher-16, Fletcher-32, and Adler-32
  * 
  * @details
  *      I decided to make a simple file to hold some different checksum 
@@ -22,15 +25,52 @@
  ******************************************************************************/
 
 #include "Checksum.h"
+#include <string.h>
+
+#if CHECKSUM_USE_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif CHECKSUM_USE_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#elif CHECKSUM_USE_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 // ***** Defines ***************************************************************
 
+/* The one's comp sums fold their carries back in after this many bytes, so 
+the 32-bit sum can never overflow no matter how long the data is. */
+#define ONES_COMP_CHUNK_SIZE    0xFFFF
+
+/* The most bytes (or words) that can be added to sums that are already 
+reduced before the second sum could overflow 32 bits. The Adler-32 one is the 
+same as NMAX in zlib. */
+#define FLETCHER16_BLOCK_SIZE   5802
+#define FLETCHER32_BLOCK_SIZE   360
+#define ADLER32_BLOCK_SIZE      5552
+#define ADLER32_MOD             65521
+
+#if CHECKSUM_USE_SIMD && (defined(__SSE2__) || defined(__ARM_NEON))
+#define CHECKSUM_VECTOR_LOOP    1
+#define CHECKSUM_VECTOR_CHUNK   32
+#else
+#define CHECKSUM_VECTOR_LOOP    0
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define CHECKSUM_BIG_ENDIAN     1
+#else
+#define CHECKSUM_BIG_ENDIAN     0
+#endif
 
 // ***** Global Variables ******************************************************
 
 
 // ***** Static Functions Prototypes *******************************************
 
+static uint64_t SumWords(const uint8_t *array, uint32_t length);
+static uint16_t Fold(uint64_t sum);
+static void SumBytes(const uint8_t *array, uint32_t length, uint32_t *sum, uint32_t *sum2);
+static void Fletcher32Words(ChecksumContext *self, const uint8_t *array, uint32_t numWords);
 
 // *****************************************************************************
 
@@ -65,6 +105,85 @@ uint16_t Checksum_TwosComp16Bit(const uint8_t *array, uint16_t length)
 // *****************************************************************************
 
 uint8_t Checksum_OnesComp8Bit(const uint8_t *array, uint16_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_OnesComp8BitInit(&context);
+    Checksum_OnesComp8BitUpdate(&context, array, length);
+    return Checksum_OnesComp8BitFinal(&context);
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_OnesComp16Bit(const uint8_t *array, uint16_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_OnesComp16BitInit(&context);
+    Checksum_OnesComp16BitUpdate(&context, array, length);
+    return Checksum_OnesComp16BitFinal(&context);
+}
+
+// *****************************************************************************
+
+void Checksum_TwosComp8BitInit(ChecksumContext *self)
+{
+    self->sum = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_TwosComp8BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    /* The carries are thrown away anyway, so the sum can just roll over */
+    uint32_t checksum = self->sum;
+    
+    for(uint32_t i = 0; i < length; i++)
+    {
+        checksum += array[i];
+    }
+    
+    self->sum = checksum;
+}
+
+// *****************************************************************************
+
+uint8_t Checksum_TwosComp8BitFinal(ChecksumContext *self)
+{
+    return (uint8_t)((uint8_t)self->sum * -1);
+}
+
+// *****************************************************************************
+
+void Checksum_TwosComp16BitInit(ChecksumContext *self)
+{
+    self->sum = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_TwosComp16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    Checksum_TwosComp8BitUpdate(self, array, length);
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_TwosComp16BitFinal(ChecksumContext *self)
+{
+    return (uint16_t)((uint16_t)self->sum * -1);
+}
+
+// *****************************************************************************
+
+void Checksum_OnesComp8BitInit(ChecksumContext *self)
+{
+    self->sum = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_OnesComp8BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length)
 {
     /* I used to think a one's complement checksum was just the sum and then
     the one's complement. It's actually the one's complement sum and then you
@@ -76,34 +195,465 @@ uint8_t Checksum_OnesComp8Bit(const uint8_t *array, uint16_t length)
     the carries, then add it back into the bottom half. Then take the one's 
     comp of that result. When you do this operation again with the checksum 
     value included, the result will be zero just like a two's comp checksum. */
-    uint16_t checksum = 0;
+    uint32_t checksum = self->sum;
     
-    for(uint16_t i = 0; i < length; i++)
+    while(length > 0)
     {
-        checksum += array[i];
+        uint16_t chunk = (length > ONES_COMP_CHUNK_SIZE) ? ONES_COMP_CHUNK_SIZE : length;
+        
+        for(uint16_t i = 0; i < chunk; i++)
+        {
+            checksum += array[i];
+        }
+        
+        checksum = (checksum & 0x000000FF) + (checksum >> 8);
+        array += chunk;
+        length -= chunk;
     }
     
-    /* Add the carry bits back into the result. Then invert the result */
-    checksum = (checksum & 0x00FF) + (checksum >> 8);
+    self->sum = checksum;
+}
+
+// *****************************************************************************
+
+uint8_t Checksum_OnesComp8BitFinal(ChecksumContext *self)
+{
+    uint32_t checksum = self->sum;
+    
+    /* Adding the carry bits back in can make another carry, so keep going 
+    until there aren't any left. Then invert the result */
+    while(checksum >> 8)
+        checksum = (checksum & 0x000000FF) + (checksum >> 8);
+    
     return (uint8_t)(~checksum);
 }
 
 // *****************************************************************************
 
-uint16_t Checksum_OnesComp16Bit(const uint8_t *array, uint16_t length)
+void Checksum_OnesComp16BitInit(ChecksumContext *self)
 {
-    uint32_t checksum = 0;
+    self->sum = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_OnesComp16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    uint32_t checksum = self->sum;
     
-    for(uint16_t i = 0; i < length; i++)
+    while(length > 0)
     {
-        checksum += array[i];
+        uint16_t chunk = (length > ONES_COMP_CHUNK_SIZE) ? ONES_COMP_CHUNK_SIZE : length;
+        
+        for(uint16_t i = 0; i < chunk; i++)
+        {
+            checksum += array[i];
+        }
+        
+        checksum = (checksum & 0x0000FFFF) + (checksum >> 16);
+        array += chunk;
+        length -= chunk;
     }
     
-    /* Add the carry bits back into the result. Then invert the result */
-    checksum = (checksum & 0x0000FFFF) + (checksum >> 16);
+    self->sum = checksum;
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_OnesComp16BitFinal(ChecksumContext *self)
+{
+    uint32_t checksum = self->sum;
+    
+    while(checksum >> 16)
+        checksum = (checksum & 0x0000FFFF) + (checksum >> 16);
+    
     return (uint16_t)(~checksum);
 }
 
+// *****************************************************************************
+
+uint16_t Checksum_Internet16Bit(const uint8_t *array, uint32_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_Internet16BitInit(&context);
+    Checksum_Internet16BitUpdate(&context, array, length);
+    return Checksum_Internet16BitFinal(&context);
+}
+
+// *****************************************************************************
+
+void Checksum_Internet16BitInit(ChecksumContext *self)
+{
+    self->sum = 0;
+    self->odd = false;
+}
+
+// *****************************************************************************
+
+void Checksum_Internet16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    /* The words are added up in whatever order the processor uses and fixed 
+    at the end. If the piece before this one had an odd number of bytes, this 
+    piece is off by one byte, which puts every byte on the wrong side of its 
+    word. RFC 1071 points out that you can just swap the two bytes of the 
+    folded sum to fix it. */
+    uint16_t sum = Fold(SumWords(array, length));
+    
+    if(self->odd)
+        sum = (uint16_t)((sum << 8) | (sum >> 8));
+    
+    self->sum = Fold((uint64_t)self->sum + sum);
+    
+    if(length & 1)
+        self->odd = !self->odd;
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_Internet16BitFinal(ChecksumContext *self)
+{
+    uint16_t sum = (uint16_t)self->sum;
+    
+#if !CHECKSUM_BIG_ENDIAN
+    /* The words were added little endian. Swap to get the big endian sum */
+    sum = (uint16_t)((sum << 8) | (sum >> 8));
+#endif
+    
+    return (uint16_t)(~sum);
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_Fletcher16(const uint8_t *array, uint32_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_Fletcher16Init(&context);
+    Checksum_Fletcher16Update(&context, array, length);
+    return Checksum_Fletcher16Final(&context);
+}
+
+// *****************************************************************************
+
+void Checksum_Fletcher16Init(ChecksumContext *self)
+{
+    self->sum = 0;
+    self->sum2 = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_Fletcher16Update(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    while(length > 0)
+    {
+        uint32_t block = (length > FLETCHER16_BLOCK_SIZE) ? FLETCHER16_BLOCK_SIZE : length;
+        
+        SumBytes(array, block, &self->sum, &self->sum2);
+        self->sum %= 255;
+        self->sum2 %= 255;
+        array += block;
+        length -= block;
+    }
+}
+
+// *****************************************************************************
+
+uint16_t Checksum_Fletcher16Final(ChecksumContext *self)
+{
+    return (uint16_t)((self->sum2 << 8) | self->sum);
+}
+
+// *****************************************************************************
+
+uint32_t Checksum_Fletcher32(const uint8_t *array, uint32_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_Fletcher32Init(&context);
+    Checksum_Fletcher32Update(&context, array, length);
+    return Checksum_Fletcher32Final(&context);
+}
+
+// *****************************************************************************
+
+void Checksum_Fletcher32Init(ChecksumContext *self)
+{
+    self->sum = 0;
+    self->sum2 = 0;
+    self->leftover = 0;
+    self->odd = false;
+}
+
+// *****************************************************************************
+
+void Checksum_Fletcher32Update(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    if(length == 0)
+        return;
+    
+    /* Finish the word that the last piece started */
+    if(self->odd)
+    {
+        uint8_t word[2] = {self->leftover, array[0]};
+        
+        Fletcher32Words(self, word, 1);
+        array++;
+        length--;
+        self->odd = false;
+    }
+    
+    Fletcher32Words(self, array, length / 2);
+    
+    if(length & 1)
+    {
+        self->leftover = array[length - 1];
+        self->odd = true;
+    }
+}
+
+// *****************************************************************************
+
+uint32_t Checksum_Fletcher32Final(ChecksumContext *self)
+{
+    if(self->odd)
+    {
+        uint8_t word[2] = {self->leftover, 0};
+        
+        Fletcher32Words(self, word, 1);
+        self->odd = false;
+    }
+    
+    return (self->sum2 << 16) | self->sum;
+}
+
+// *****************************************************************************
+
+uint32_t Checksum_Adler32(const uint8_t *array, uint32_t length)
+{
+    ChecksumContext context;
+    
+    Checksum_Adler32Init(&context);
+    Checksum_Adler32Update(&context, array, length);
+    return Checksum_Adler32Final(&context);
+}
+
+// *****************************************************************************
+
+void Checksum_Adler32Init(ChecksumContext *self)
+{
+    /* Adler-32 starts the first sum at one, so that leading zeros change it */
+    self->sum = 1;
+    self->sum2 = 0;
+}
+
+// *****************************************************************************
+
+void Checksum_Adler32Update(ChecksumContext *self, const uint8_t *array, uint32_t length)
+{
+    while(length > 0)
+    {
+        uint32_t block = (length > ADLER32_BLOCK_SIZE) ? ADLER32_BLOCK_SIZE : length;
+        
+        SumBytes(array, block, &self->sum, &self->sum2);
+        self->sum %= ADLER32_MOD;
+        self->sum2 %= ADLER32_MOD;
+        array += block;
+        length -= block;
+    }
+}
+
+// *****************************************************************************
+
+uint32_t Checksum_Adler32Final(ChecksumContext *self)
+{
+    return (self->sum2 << 16) | self->sum;
+}
+
+// *****************************************************************************
+
+static uint64_t SumWords(const uint8_t *array, uint32_t length)
+{
+    uint64_t sum = 0;
+    uint64_t word;
+    
+#if CHECKSUM_USE_SIMD && defined(__AVX2__)
+    /* Spread eight 32-bit words out into 64-bit lanes so they can never 
+    overflow, and add them up */
+    __m256i zero = _mm256_setzero_si256();
+    __m256i acc = zero;
+    
+    while(length >= 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)array);
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(v, zero));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(v, zero));
+        array += 32;
+        length -= 32;
+    }
+    
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif CHECKSUM_USE_SIMD && defined(__SSE2__)
+    __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    
+    while(length >= 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)array);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, zero));
+        array += 16;
+        length -= 16;
+    }
+    
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    sum = lanes[0] + lanes[1];
+#elif CHECKSUM_USE_SIMD && defined(__ARM_NEON)
+    /* Pairwise add neighboring 32-bit words into 64-bit lanes */
+    uint64x2_t acc = vdupq_n_u64(0);
+    
+    while(length >= 16)
+    {
+        acc = vpadalq_u32(acc, vreinterpretq_u32_u8(vld1q_u8(array)));
+        array += 16;
+        length -= 16;
+    }
+    sum = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+#endif
+    
+    /* Eight bytes at a time. Each half is less than 2^32, so the sum can't 
+    overflow until well past 4 GB */
+    while(length >= 8)
+    {
+        memcpy(&word, array, 8);
+        sum += (word & 0xFFFFFFFF) + (word >> 32);
+        array += 8;
+        length -= 8;
+    }
+    
+    /* Whatever is left gets padded out with zeros, just like RFC 1071 says 
+    to do with an odd byte at the end */
+    if(length > 0)
+    {
+        word = 0;
+        memcpy(&word, array, length);
+        sum += (word & 0xFFFFFFFF) + (word >> 32);
+    }
+    
+    return sum;
+}
+
+// *****************************************************************************
+
+static uint16_t Fold(uint64_t sum)
+{
+    while(sum >> 16)
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    
+    return (uint16_t)sum;
+}
+
+// *****************************************************************************
+
+static void SumBytes(const uint8_t *array, uint32_t length, uint32_t *sum, uint32_t *sum2)
+{
+    uint32_t a = *sum;
+    uint32_t b = *sum2;
+    
+#if CHECKSUM_VECTOR_LOOP
+    /* Over a chunk, the second sum gets the first sum once for every byte, 
+    plus each byte once for every byte from there to the end of the chunk. 
+    Written this way, every byte in the chunk is independent, so the 
+    compiler can do them all at once. The chunk is a constant size so that 
+    it will even at -O2. The sums come out exactly the same as the plain 
+    loop at the end of every chunk, so the block size still keeps them from 
+    overflowing. */
+    while(length >= CHECKSUM_VECTOR_CHUNK)
+    {
+        uint32_t byteSum = 0;
+        uint32_t weighted = 0;
+        
+        for(uint32_t i = 0; i < CHECKSUM_VECTOR_CHUNK; i++)
+        {
+            byteSum += array[i];
+            weighted += (CHECKSUM_VECTOR_CHUNK - i) * (uint32_t)array[i];
+        }
+        
+        b += CHECKSUM_VECTOR_CHUNK * a + weighted;
+        a += byteSum;
+        array += CHECKSUM_VECTOR_CHUNK;
+        length -= CHECKSUM_VECTOR_CHUNK;
+    }
+#else
+    /* Unrolled by eight. No multiplies, which is best on small parts */
+    while(length >= 8)
+    {
+        a += array[0]; b += a;
+        a += array[1]; b += a;
+        a += array[2]; b += a;
+        a += array[3]; b += a;
+        a += array[4]; b += a;
+        a += array[5]; b += a;
+        a += array[6]; b += a;
+        a += array[7]; b += a;
+        array += 8;
+        length -= 8;
+    }
+#endif
+    
+    while(length > 0)
+    {
+        a += *array++;
+        b += a;
+        length--;
+    }
+    
+    *sum = a;
+    *sum2 = b;
+}
+
+// *****************************************************************************
+
+static void Fletcher32Words(ChecksumContext *self, const uint8_t *array, uint32_t numWords)
+{
+    uint32_t a = self->sum;
+    uint32_t b = self->sum2;
+    
+    while(numWords > 0)
+    {
+        uint32_t block = (numWords > FLETCHER32_BLOCK_SIZE) ? FLETCHER32_BLOCK_SIZE : numWords;
+        numWords -= block;
+        
+        while(block >= 4)
+        {
+            a += (uint32_t)array[0] | (uint32_t)array[1] << 8; b += a;
+            a += (uint32_t)array[2] | (uint32_t)array[3] << 8; b += a;
+            a += (uint32_t)array[4] | (uint32_t)array[5] << 8; b += a;
+            a += (uint32_t)array[6] | (uint32_t)array[7] << 8; b += a;
+            array += 8;
+            block -= 4;
+        }
+        
+        while(block > 0)
+        {
+            a += (uint32_t)array[0] | (uint32_t)array[1] << 8;
+            b += a;
+            array += 2;
+            block--;
+        }
+        
+        a %= 65535;
+        b %= 65535;
+    }
+    
+    self->sum = a;
+    self->sum2 = b;
+}
+
 /*
  End of File
  */
\ No newline at end of file
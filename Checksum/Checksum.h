@@ -6,11 +6,50 @@
  * @author Matthew Spinks <https://github.com/mspinksosu>
  * 
  * @date 2/25/23   Original creation
+ * @date 10/16/26  Added streaming init/update/final functions
+ * @date 10/16/26  Added Internet checksum
+ * @date 10/16/26  Added Fletcher-16, Fletcher-32, and Adler-32
  * 
  * @details
  *      I decided to make a simple file to hold some different checksum 
  * routines, since it's something that I use a lot.
  * 
+ * Each checksum can be done all at once, or a piece at a time. If your frame
+ * comes in a few bytes at a time, or is split across the end of a ring 
+ * buffer, make a ChecksumContext, call Init, then call Update with each 
+ * piece as you get it. Final gives you the same answer you would get if you 
+ * had handed the whole frame to the regular function. The Update functions 
+ * take a 32-bit length, so the total can be bigger than 65535 bytes.
+ * 
+ *      ChecksumContext context;
+ *      Checksum_OnesComp16BitInit(&context);
+ *      Checksum_OnesComp16BitUpdate(&context, firstPiece, firstLength);
+ *      Checksum_OnesComp16BitUpdate(&context, secondPiece, secondLength);
+ *      uint16_t result = Checksum_OnesComp16BitFinal(&context);
+ * 
+ * The CRC's have their own Update and Final functions in CRC.h.
+ * 
+ * Checksum_OnesComp16Bit adds up bytes. The checksum used by IP, UDP, and 
+ * TCP (RFC 1071) is different. It adds up 16-bit big endian words. That one 
+ * is Checksum_Internet16Bit. Since the order you add things up in doesn't 
+ * matter for a one's comp sum, it adds 32-bit words into a 64-bit sum and 
+ * only folds the carries back in at the very end. On a host with SSE2, AVX2, 
+ * or NEON it will add 16 or 32 bytes at a time. Everything else uses the 
+ * plain C version. Set CHECKSUM_USE_SIMD to 0 to always use the plain C 
+ * version. The result is a normal number, so to put it in a packet, store 
+ * the upper byte first.
+ * 
+ * Fletcher and Adler checksums keep two sums. The first is the sum of the 
+ * data, and the second is the sum of the first sum after every byte. That 
+ * makes them catch swapped bytes, which a plain sum can't. They are still 
+ * just adds, so they cost about the same as the two's comp sums. Fletcher-16 
+ * works on bytes mod 255, Fletcher-32 works on 16-bit little endian words 
+ * mod 65535 (an odd byte at the end gets a zero byte added), and Adler-32 
+ * (used by zlib) works on bytes mod 65521. Instead of doing a modulo for 
+ * every byte, they only do it once per block. The block is as long as it 
+ * can be without overflowing a 32-bit sum. On a host with a vector unit, 
+ * the bytes are added in a way the compiler can vectorize.
+ * 
  * @section license License
  * SPDX-FileCopyrightText: © 2023 Matthew Spinks
  * SPDX-License-Identifier: Zlib
@@ -29,9 +68,30 @@
 
 // ***** Defines ***************************************************************
 
+#ifndef CHECKSUM_USE_SIMD
+#define CHECKSUM_USE_SIMD   1
+#endif
 
 // ***** Global Variables ******************************************************
 
+typedef struct ChecksumContextTag
+{
+    uint32_t sum;
+    uint32_t sum2;
+    uint8_t leftover;
+    bool odd;
+} ChecksumContext;
+
+/**
+ * sum  running sum. Use the functions, since each checksum keeps it a little 
+ *      differently
+ * 
+ * sum2  the second sum for Fletcher and Adler checksums
+ * 
+ * leftover  the odd byte waiting for the next piece in Fletcher-32
+ * 
+ * odd  true if an odd number of bytes have gone in
+ */
 
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
@@ -47,4 +107,60 @@ uint8_t Checksum_OnesComp8Bit(const uint8_t *array, uint16_t length);
 
 uint16_t Checksum_OnesComp16Bit(const uint8_t *array, uint16_t length);
 
+void Checksum_TwosComp8BitInit(ChecksumContext *self);
+
+void Checksum_TwosComp8BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint8_t Checksum_TwosComp8BitFinal(ChecksumContext *self);
+
+void Checksum_TwosComp16BitInit(ChecksumContext *self);
+
+void Checksum_TwosComp16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint16_t Checksum_TwosComp16BitFinal(ChecksumContext *self);
+
+void Checksum_OnesComp8BitInit(ChecksumContext *self);
+
+void Checksum_OnesComp8BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint8_t Checksum_OnesComp8BitFinal(ChecksumContext *self);
+
+void Checksum_OnesComp16BitInit(ChecksumContext *self);
+
+void Checksum_OnesComp16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint16_t Checksum_OnesComp16BitFinal(ChecksumContext *self);
+
+uint16_t Checksum_Internet16Bit(const uint8_t *array, uint32_t length);
+
+void Checksum_Internet16BitInit(ChecksumContext *self);
+
+void Checksum_Internet16BitUpdate(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint16_t Checksum_Internet16BitFinal(ChecksumContext *self);
+
+uint16_t Checksum_Fletcher16(const uint8_t *array, uint32_t length);
+
+void Checksum_Fletcher16Init(ChecksumContext *self);
+
+void Checksum_Fletcher16Update(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint16_t Checksum_Fletcher16Final(ChecksumContext *self);
+
+uint32_t Checksum_Fletcher32(const uint8_t *array, uint32_t length);
+
+void Checksum_Fletcher32Init(ChecksumContext *self);
+
+void Checksum_Fletcher32Update(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint32_t Checksum_Fletcher32Final(ChecksumContext *self);
+
+uint32_t Checksum_Adler32(const uint8_t *array, uint32_t length);
+
+void Checksum_Adler32Init(ChecksumContext *self);
+
+void Checksum_Adler32Update(ChecksumContext *self, const uint8_t *array, uint32_t length);
+
+uint32_t Checksum_Adler32Final(ChecksumContext *self);
+
 #endif  /* CHECKSUM_H */
\ No newline at end of file
@@ -0,0 +1,117 @@
+/* Program to print a CRC table as a const array that can go in flash - MS
+
+   Pick one of the built in models, or give all six numbers of your own model.
+   The method is nibble, byte, or slice8. Paste the output into a C file and
+   give it to CRC_InitWithConstTable with the same model and method.
+
+   gcc GenerateCRCTable.c CRC.c -o GenerateCRCTable
+   ./GenerateCRCTable crc16modbus byte > CRC16ModbusTable.c
+   ./GenerateCRCTable custom nibble width poly init refIn refOut xorOut */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "CRC.h"
+
+static const struct
+{
+    const char *name;
+    const CRCModel *model;
+} models[] = {
+    {"crc8", &CRC_MODEL_CRC8},
+    {"crc8maxim", &CRC_MODEL_CRC8_MAXIM},
+    {"crc16ccittfalse", &CRC_MODEL_CRC16_CCITT_FALSE},
+    {"crc16kermit", &CRC_MODEL_CRC16_KERMIT},
+    {"crc16xmodem", &CRC_MODEL_CRC16_XMODEM},
+    {"crc16modbus", &CRC_MODEL_CRC16_MODBUS},
+    {"crc32", &CRC_MODEL_CRC32},
+    {"crc32c", &CRC_MODEL_CRC32C},
+};
+
+static uint32_t table[CRC_SLICE8_TABLE_SIZE];
+
+static void Usage(void)
+{
+    printf("Usage: GenerateCRCTable model method\n");
+    printf("       GenerateCRCTable custom method width poly init refIn refOut xorOut\n");
+    printf("models:");
+    for(uint32_t i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+        printf(" %s", models[i].name);
+    printf("\nmethods: nibble byte slice8\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const CRCModel *model = NULL;
+    CRCModel custom;
+    CRCMethod method;
+    uint32_t size;
+
+    if(argc < 3)
+    {
+        Usage();
+        return 1;
+    }
+
+    if(strcmp(argv[1], "custom") == 0 && argc >= 9)
+    {
+        custom.width = strtoul(argv[3], NULL, 0);
+        custom.poly = strtoul(argv[4], NULL, 0);
+        custom.init = strtoul(argv[5], NULL, 0);
+        custom.refIn = strtoul(argv[6], NULL, 0) != 0;
+        custom.refOut = strtoul(argv[7], NULL, 0) != 0;
+        custom.xorOut = strtoul(argv[8], NULL, 0);
+        custom.check = 0;
+        model = &custom;
+    }
+    else
+    {
+        for(uint32_t i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+        {
+            if(strcmp(argv[1], models[i].name) == 0)
+                model = models[i].model;
+        }
+    }
+
+    if(strcmp(argv[2], "nibble") == 0)
+    {
+        method = CRC_METHOD_NIBBLE;
+        size = CRC_NIBBLE_TABLE_SIZE;
+    }
+    else if(strcmp(argv[2], "byte") == 0)
+    {
+        method = CRC_METHOD_BYTE;
+        size = CRC_BYTE_TABLE_SIZE;
+    }
+    else if(strcmp(argv[2], "slice8") == 0)
+    {
+        method = CRC_METHOD_SLICE8;
+        size = CRC_SLICE8_TABLE_SIZE;
+    }
+    else
+    {
+        model = NULL;
+    }
+
+    if(model == NULL || model->width < 1 || model->width > 32)
+    {
+        Usage();
+        return 1;
+    }
+
+    CRC_GenerateTable(model, method, table);
+
+    printf("/* %s %s table. Width %u, poly 0x%X, init 0x%X, refIn %u, refOut %u, xorOut 0x%X */\n",
+        argv[1], argv[2], model->width, model->poly, model->init, model->refIn,
+        model->refOut, model->xorOut);
+    printf("const uint32_t %s_%s_table[%u] =\n{", argv[1], argv[2], size);
+
+    for(uint32_t i = 0; i < size; i++)
+    {
+        if(i % 8 == 0)
+            printf("\n   ");
+        printf(" 0x%08XUL%s", table[i], (i + 1 < size) ? "," : "");
+    }
+    printf("\n};\n");
+    return 0;
+}
@@ -0,0 +1,308 @@
+/* Program to benchmark every checksum and CRC in this folder - MS
+
+   Runs each one over message sizes from 8 bytes to 64 MB, once with the data
+   lined up on a 64 byte boundary and once starting one byte off. Each size
+   is repeated in batches until it has run for at least a little while, and
+   the clock is only read around each batch, so the time to read it doesn't
+   swamp the small sizes. Prints one CSV line per test with GB/s and cycles
+   per byte (from the time stamp counter on x86, so it counts at the base
+   clock, not the turbo clock). Use it to pick a checksum for a product, or
+   run it before and after a change to catch a slow down.
+
+   Every one is first checked against its value for the ASCII string
+   "123456789". Then, for each message, every CRC method for the same model
+   and every streaming or hardware path must give the same answer. The
+   program returns 1 if anything doesn't match.
+
+   gcc -O2 TestBenchmark.c Checksum.c CRC.c CRC_x86.c -o TestBenchmark
+   ./TestBenchmark [maxSize] [secondsPerTest] > results.csv */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Checksum.h"
+#include "CRC.h"
+#include "CRC_x86.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES     1
+#else
+#define HAVE_CYCLES     0
+#endif
+
+#define DEFAULT_MAX_SIZE    (64UL * 1024 * 1024)
+#define DEFAULT_SECONDS     0.02
+#define MAX_VARIANTS        64
+
+/* The bitwise CRC's are so slow that they stop at 1 MB */
+#define BITWISE_MAX_SIZE    (1024UL * 1024)
+
+typedef struct VariantTag Variant;
+
+struct VariantTag
+{
+    char name[40];
+    const char *family;
+    uint32_t (*Run)(Variant *variant, const uint8_t *data, uint32_t length);
+    uint32_t maxLength;
+    uint32_t check;
+    CRC crc;
+    uint32_t table[CRC_SLICE8_TABLE_SIZE];
+};
+
+static Variant variants[MAX_VARIANTS];
+static uint32_t numVariants;
+
+// ***** Wrappers so that everything looks the same ****************************
+
+static uint32_t RunTwosComp8(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_TwosComp8Bit(d, n); }
+static uint32_t RunTwosComp16(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_TwosComp16Bit(d, n); }
+static uint32_t RunOnesComp8(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_OnesComp8Bit(d, n); }
+static uint32_t RunOnesComp16(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_OnesComp16Bit(d, n); }
+static uint32_t RunInternet(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_Internet16Bit(d, n); }
+static uint32_t RunFletcher16(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_Fletcher16(d, n); }
+static uint32_t RunFletcher32(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_Fletcher32(d, n); }
+static uint32_t RunAdler32(Variant *v, const uint8_t *d, uint32_t n) { (void)v; return Checksum_Adler32(d, n); }
+static uint32_t RunCRC(Variant *v, const uint8_t *d, uint32_t n) { return CRC_Compute(&v->crc, d, n); }
+
+/* Two's comp sums don't care how the data is split up, but the streaming
+versions of the others do, so try them with uneven pieces */
+static uint32_t RunInternetStreaming(Variant *v, const uint8_t *d, uint32_t n)
+{
+    ChecksumContext context;
+    uint32_t first = n / 3 | 1;
+    (void)v;
+
+    if(first > n)
+        first = n;
+
+    Checksum_Internet16BitInit(&context);
+    Checksum_Internet16BitUpdate(&context, d, first);
+    Checksum_Internet16BitUpdate(&context, d + first, n - first);
+    return Checksum_Internet16BitFinal(&context);
+}
+
+static uint32_t RunFletcher32Streaming(Variant *v, const uint8_t *d, uint32_t n)
+{
+    ChecksumContext context;
+    uint32_t first = n / 3 | 1;
+    (void)v;
+
+    if(first > n)
+        first = n;
+
+    Checksum_Fletcher32Init(&context);
+    Checksum_Fletcher32Update(&context, d, first);
+    Checksum_Fletcher32Update(&context, d + first, n - first);
+    return Checksum_Fletcher32Final(&context);
+}
+
+static uint32_t RunAdler32Streaming(Variant *v, const uint8_t *d, uint32_t n)
+{
+    ChecksumContext context;
+    uint32_t first = n / 3 | 1;
+    (void)v;
+
+    if(first > n)
+        first = n;
+
+    Checksum_Adler32Init(&context);
+    Checksum_Adler32Update(&context, d, first);
+    Checksum_Adler32Update(&context, d + first, n - first);
+    return Checksum_Adler32Final(&context);
+}
+
+// *****************************************************************************
+
+static Variant *AddVariant(const char *name, const char *family,
+    uint32_t (*Run)(Variant *, const uint8_t *, uint32_t), uint32_t maxLength, uint32_t check)
+{
+    Variant *v = &variants[numVariants++];
+
+    snprintf(v->name, sizeof(v->name), "%s", name);
+    v->family = family;
+    v->Run = Run;
+    v->maxLength = maxLength;
+    v->check = check;
+    return v;
+}
+
+static void AddCRC(const char *name, const CRCModel *model)
+{
+    static const char *methodNames[] = {"bitwise", "nibble", "byte", "slice8"};
+    char fullName[40];
+
+    for(CRCMethod method = CRC_METHOD_BITWISE; method <= CRC_METHOD_SLICE8; method++)
+    {
+        snprintf(fullName, sizeof(fullName), "%s %s", name, methodNames[method]);
+        Variant *v = AddVariant(fullName, name, RunCRC,
+            (method == CRC_METHOD_BITWISE) ? BITWISE_MAX_SIZE : UINT32_MAX, model->check);
+        CRC_Init(&v->crc, model, method, v->table);
+    }
+
+    /* Only add the hardware one if there is hardware for it */
+    Variant *v = AddVariant(name, name, RunCRC, UINT32_MAX, model->check);
+    CRC_x86_Init(&v->crc, model, v->table);
+
+    if(CRC_x86_GetPath(&v->crc) == CRC_X86_PATH_SSE42)
+        snprintf(v->name, sizeof(v->name), "%s sse4.2", name);
+    else if(CRC_x86_GetPath(&v->crc) == CRC_X86_PATH_PCLMUL)
+        snprintf(v->name, sizeof(v->name), "%s pclmul", name);
+    else
+        numVariants--;
+}
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t Cycles(void)
+{
+#if HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    const uint64_t sizes[] = {8, 64, 512, 4096, 32768, 262144, 2097152, 16777216, 67108864};
+    uint64_t maxSize = DEFAULT_MAX_SIZE;
+    double secondsPerTest = DEFAULT_SECONDS;
+    int errors = 0;
+
+    if(argc > 1)
+        maxSize = strtoull(argv[1], NULL, 0);
+    if(argc > 2)
+        secondsPerTest = atof(argv[2]);
+
+    AddVariant("TwosComp8Bit", "TwosComp8Bit", RunTwosComp8, UINT16_MAX, 0x23);
+    AddVariant("TwosComp16Bit", "TwosComp16Bit", RunTwosComp16, UINT16_MAX, 0xFE23);
+    AddVariant("OnesComp8Bit", "OnesComp8Bit", RunOnesComp8, UINT16_MAX, 0x21);
+    AddVariant("OnesComp16Bit", "OnesComp16Bit", RunOnesComp16, UINT16_MAX, 0xFE22);
+    AddVariant("Internet16Bit", "Internet16Bit", RunInternet, UINT32_MAX, 0xF62A);
+    AddVariant("Internet16Bit streaming", "Internet16Bit", RunInternetStreaming, UINT32_MAX, 0xF62A);
+    AddVariant("Fletcher16", "Fletcher16", RunFletcher16, UINT32_MAX, 0x1EDE);
+    AddVariant("Fletcher32", "Fletcher32", RunFletcher32, UINT32_MAX, 0xDF09D509);
+    AddVariant("Fletcher32 streaming", "Fletcher32", RunFletcher32Streaming, UINT32_MAX, 0xDF09D509);
+    AddVariant("Adler32", "Adler32", RunAdler32, UINT32_MAX, 0x091E01DE);
+    AddVariant("Adler32 streaming", "Adler32", RunAdler32Streaming, UINT32_MAX, 0x091E01DE);
+    AddCRC("CRC-8", &CRC_MODEL_CRC8);
+    AddCRC("CRC-16/CCITT-FALSE", &CRC_MODEL_CRC16_CCITT_FALSE);
+    AddCRC("CRC-16/MODBUS", &CRC_MODEL_CRC16_MODBUS);
+    AddCRC("CRC-32", &CRC_MODEL_CRC32);
+    AddCRC("CRC-32C", &CRC_MODEL_CRC32C);
+
+    // Check values
+    for(uint32_t i = 0; i < numVariants; i++)
+    {
+        uint32_t result = variants[i].Run(&variants[i], (const uint8_t *)"123456789", 9);
+
+        if(result != variants[i].check)
+        {
+            fprintf(stderr, "FAIL %s check value 0x%X expected 0x%X\n", variants[i].name,
+                result, variants[i].check);
+            errors++;
+        }
+    }
+
+    /* Allocate a little extra so there's room to start one byte off */
+    uint8_t *buffer = malloc(maxSize + 128);
+    if(buffer == NULL)
+    {
+        fprintf(stderr, "FAIL could not allocate %llu bytes\n",
+            (unsigned long long)maxSize + 128);
+        return 1;
+    }
+    uint8_t *aligned = (uint8_t *)(((uintptr_t)buffer + 63) & ~(uintptr_t)63);
+    srand(1234);
+    for(uint64_t i = 0; i < maxSize + 64; i++)
+        aligned[i] = rand();
+
+    printf("name,size,offset,reps,GB/s,cycles/byte\n");
+
+    for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && sizes[s] <= maxSize; s++)
+    {
+        uint64_t size = sizes[s];
+
+        for(uint32_t offset = 0; offset <= 1; offset++)
+        {
+            const uint8_t *data = aligned + offset;
+            const char *lastFamily = NULL;
+            uint32_t expected = 0;
+
+            for(uint32_t i = 0; i < numVariants; i++)
+            {
+                Variant *v = &variants[i];
+
+                if(size > v->maxLength)
+                    continue;
+
+                /* Everything in the same family must give the same answer.
+                The first one that runs is the one to match. */
+                uint32_t result = v->Run(v, data, size);
+                if(lastFamily == NULL || strcmp(lastFamily, v->family) != 0)
+                {
+                    lastFamily = v->family;
+                    expected = result;
+                }
+                else if(result != expected)
+                {
+                    fprintf(stderr, "FAIL %s size %llu offset %u\n", v->name,
+                        (unsigned long long)size, offset);
+                    errors++;
+                }
+
+                /* Reading the clock takes longer than a small message, so
+                only read it around a whole batch. Double the batch until
+                one batch takes a good part of the test time, then keep
+                running batches of that size. */
+                uint64_t reps = 0, batch = 1, cycles = 0;
+                double elapsed = 0;
+                while(1)
+                {
+                    double start = Seconds();
+                    for(uint64_t r = 0; r < batch; r++)
+                    {
+                        volatile uint32_t sink = v->Run(v, data, size);
+                        (void)sink;
+                    }
+                    if(Seconds() - start >= secondsPerTest / 8 || batch >= (1ULL << 40))
+                        break;
+                    batch *= 2;
+                }
+                while(elapsed < secondsPerTest)
+                {
+                    double start = Seconds();
+                    uint64_t startCycles = Cycles();
+                    for(uint64_t r = 0; r < batch; r++)
+                    {
+                        volatile uint32_t sink = v->Run(v, data, size);
+                        (void)sink;
+                    }
+                    cycles += Cycles() - startCycles;
+                    elapsed += Seconds() - start;
+                    reps += batch;
+                }
+
+                double bytes = (double)size * reps;
+                printf("%s,%llu,%u,%llu,%.3f,", v->name, (unsigned long long)size,
+                    offset, (unsigned long long)reps, bytes / elapsed / 1e9);
+                if(HAVE_CYCLES)
+                    printf("%.3f\n", cycles / bytes);
+                else
+                    printf("n/a\n");
+            }
+        }
+    }
+    free(buffer);
+
+    fprintf(stderr, errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
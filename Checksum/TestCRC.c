@@ -0,0 +1,163 @@
+/* Program to test and benchmark the CRC library - MS
+
+   Checks every method of every model against its check value, plus a few odd
+   widths. Then runs random lengths through all four methods and makes sure
+   they agree, and feeds the same data to CRC_Update in random sized pieces to
+   make sure the streaming result is the same. Last, it reports MB/s for each method using CRC-32.
+
+   gcc -O2 TestCRC.c CRC.c -o TestCRC
+   ./TestCRC [benchmarkMegabytes] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "CRC.h"
+
+#define DEFAULT_MEGABYTES   64
+#define NUM_RANDOM_TESTS    200
+
+static const CRCModel CRC3_ROHC =
+    {.width = 3, .poly = 0x3, .init = 0x7, .refIn = true, .refOut = true,
+    .xorOut = 0x0, .check = 0x6};
+
+static const CRCModel CRC5_USB =
+    {.width = 5, .poly = 0x05, .init = 0x1F, .refIn = true, .refOut = true,
+    .xorOut = 0x1F, .check = 0x19};
+
+static const CRCModel CRC12_UMTS =
+    {.width = 12, .poly = 0x80F, .init = 0x000, .refIn = false, .refOut = true,
+    .xorOut = 0x000, .check = 0xDAF};
+
+static const CRCModel CRC24_OPENPGP =
+    {.width = 24, .poly = 0x864CFB, .init = 0xB704CE, .refIn = false, .refOut = false,
+    .xorOut = 0x000000, .check = 0x21CF02};
+
+static const struct
+{
+    const char *name;
+    const CRCModel *model;
+} models[] = {
+    {"CRC-3/ROHC", &CRC3_ROHC},
+    {"CRC-5/USB", &CRC5_USB},
+    {"CRC-8", &CRC_MODEL_CRC8},
+    {"CRC-8/MAXIM", &CRC_MODEL_CRC8_MAXIM},
+    {"CRC-12/UMTS", &CRC12_UMTS},
+    {"CRC-16/CCITT-FALSE", &CRC_MODEL_CRC16_CCITT_FALSE},
+    {"CRC-16/KERMIT", &CRC_MODEL_CRC16_KERMIT},
+    {"CRC-16/XMODEM", &CRC_MODEL_CRC16_XMODEM},
+    {"CRC-16/MODBUS", &CRC_MODEL_CRC16_MODBUS},
+    {"CRC-24/OPENPGP", &CRC24_OPENPGP},
+    {"CRC-32", &CRC_MODEL_CRC32},
+    {"CRC-32C", &CRC_MODEL_CRC32C},
+};
+
+static const char *methodNames[] = {"bitwise", "nibble", "byte", "slice8"};
+
+static uint32_t table[4][CRC_SLICE8_TABLE_SIZE];
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    const uint8_t *check = (const uint8_t *)"123456789";
+    uint32_t megabytes = DEFAULT_MEGABYTES;
+    int errors = 0;
+    CRC crc[4];
+
+    if(argc > 1)
+        megabytes = strtoul(argv[1], NULL, 0);
+
+    // Check values
+    for(uint32_t m = 0; m < sizeof(models) / sizeof(models[0]); m++)
+    {
+        for(CRCMethod method = CRC_METHOD_BITWISE; method <= CRC_METHOD_SLICE8; method++)
+        {
+            CRC_Init(&crc[method], models[m].model, method, table[method]);
+            uint32_t result = CRC_Compute(&crc[method], check, 9);
+
+            if(result != models[m].model->check)
+            {
+                printf("FAIL %s %s: got 0x%08X expected 0x%08X\n", models[m].name,
+                    methodNames[method], result, models[m].model->check);
+                errors++;
+            }
+        }
+    }
+
+    // Random lengths and alignments, all methods must agree
+    uint8_t *data = malloc(4096 + 8);
+    srand(1234);
+    for(uint32_t i = 0; i < 4096 + 8; i++)
+        data[i] = rand();
+
+    for(uint32_t m = 0; m < sizeof(models) / sizeof(models[0]); m++)
+    {
+        for(CRCMethod method = CRC_METHOD_BITWISE; method <= CRC_METHOD_SLICE8; method++)
+            CRC_Init(&crc[method], models[m].model, method, table[method]);
+
+        for(uint32_t i = 0; i < NUM_RANDOM_TESTS; i++)
+        {
+            uint32_t offset = rand() % 8;
+            uint32_t length = rand() % 4096;
+            uint32_t expected = CRC_Compute(&crc[CRC_METHOD_BITWISE], &data[offset], length);
+
+            for(CRCMethod method = CRC_METHOD_NIBBLE; method <= CRC_METHOD_SLICE8; method++)
+            {
+                if(CRC_Compute(&crc[method], &data[offset], length) != expected)
+                {
+                    printf("FAIL %s %s length %u offset %u\n", models[m].name,
+                        methodNames[method], length, offset);
+                    errors++;
+                }
+            }
+
+            CRCMethod method = rand() % 4;
+            uint32_t done = 0;
+            while(done < length)
+            {
+                uint32_t piece = rand() % 100;
+                if(piece > length - done)
+                    piece = length - done;
+                CRC_Update(&crc[method], &data[offset + done], piece);
+                done += piece;
+            }
+            if(CRC_Final(&crc[method]) != expected)
+            {
+                printf("FAIL %s %s streaming length %u\n", models[m].name,
+                    methodNames[method], length);
+                errors++;
+            }
+        }
+    }
+    free(data);
+
+    // Benchmark
+    uint32_t size = megabytes * 1024 * 1024;
+    data = malloc(size);
+    for(uint32_t i = 0; i < size; i++)
+        data[i] = (uint8_t)(i * 2654435761UL >> 24);
+
+    printf("method,MB/s\n");
+    for(CRCMethod method = CRC_METHOD_BITWISE; method <= CRC_METHOD_SLICE8; method++)
+    {
+        /* The bitwise method is slow, so give it a smaller piece */
+        uint32_t length = (method == CRC_METHOD_BITWISE) ? size / 16 : size;
+
+        CRC_Init(&crc[method], &CRC_MODEL_CRC32, method, table[method]);
+        double start = Seconds();
+        volatile uint32_t result = CRC_Compute(&crc[method], data, length);
+        double seconds = Seconds() - start;
+        (void)result;
+        printf("%s,%.1f\n", methodNames[method], length / seconds / 1e6);
+    }
+    free(data);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
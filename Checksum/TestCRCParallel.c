@@ -0,0 +1,128 @@
+/* Program to test CRC_Combine and benchmark CRC_Parallel_Compute - MS
+
+   First splits random data at a random spot and checks that CRC_Combine of
+   the two halves matches the CRC of the whole thing, for several models
+   including odd widths and one that isn't reflected. Then checks that
+   CRC_Parallel_Compute matches CRC_Compute for a few lengths and thread
+   counts. Last, it reports GB/s for 1 to 16 threads on a big buffer using
+   the fastest CRC-32 the processor has.
+
+   gcc -O2 -pthread TestCRCParallel.c CRC_Parallel.c CRC_x86.c CRC.c -o TestCRCParallel
+   ./TestCRCParallel [benchmarkMegabytes] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "CRC_Parallel.h"
+#include "CRC_x86.h"
+
+#define NUM_TESTS           500
+#define MAX_LENGTH          5000
+#define DEFAULT_MEGABYTES   1024
+
+static const CRCModel CRC5_USB =
+    {.width = 5, .poly = 0x05, .init = 0x1F, .refIn = true, .refOut = true,
+    .xorOut = 0x1F, .check = 0x19};
+
+static const CRCModel CRC12_UMTS =
+    {.width = 12, .poly = 0x80F, .init = 0x000, .refIn = false, .refOut = true,
+    .xorOut = 0x000, .check = 0xDAF};
+
+static const CRCModel CRC24_OPENPGP =
+    {.width = 24, .poly = 0x864CFB, .init = 0xB704CE, .refIn = false, .refOut = false,
+    .xorOut = 0x000000, .check = 0x21CF02};
+
+static const CRCModel *models[] = {
+    &CRC5_USB, &CRC_MODEL_CRC8, &CRC12_UMTS, &CRC_MODEL_CRC16_CCITT_FALSE,
+    &CRC_MODEL_CRC16_MODBUS, &CRC24_OPENPGP, &CRC_MODEL_CRC32, &CRC_MODEL_CRC32C,
+};
+
+static uint32_t table[CRC_SLICE8_TABLE_SIZE];
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t megabytes = DEFAULT_MEGABYTES;
+    uint32_t threadCounts[] = {1, 2, 4, 8, 16};
+    int errors = 0;
+    CRC crc;
+
+    if(argc > 1)
+        megabytes = strtoul(argv[1], NULL, 0);
+
+    uint64_t size = (uint64_t)megabytes * 1024 * 1024;
+    if(size < 8UL * 1024 * 1024)
+        size = 8UL * 1024 * 1024;
+
+    uint8_t *data = malloc(size);
+    srand(1234);
+    for(uint64_t i = 0; i < size; i++)
+        data[i] = (uint8_t)(i * 2654435761UL >> 24) ^ (uint8_t)rand();
+
+    // Combine
+    for(uint32_t m = 0; m < sizeof(models) / sizeof(models[0]); m++)
+    {
+        CRC_Init(&crc, models[m], CRC_METHOD_BYTE, table);
+
+        for(uint32_t i = 0; i < NUM_TESTS; i++)
+        {
+            uint32_t length = rand() % MAX_LENGTH;
+            uint32_t split = length ? rand() % (length + 1) : 0;
+            uint32_t crcA = CRC_Compute(&crc, data, split);
+            uint32_t crcB = CRC_Compute(&crc, &data[split], length - split);
+
+            if(CRC_Combine(&crc, crcA, crcB, length - split) != CRC_Compute(&crc, data, length))
+            {
+                printf("FAIL combine width %u length %u split %u\n", models[m]->width, length, split);
+                errors++;
+            }
+        }
+    }
+
+    // Parallel matches serial
+    CRC_Init(&crc, &CRC_MODEL_CRC16_CCITT_FALSE, CRC_METHOD_SLICE8, table);
+    uint64_t lengths[] = {0, 1, 1000, CRC_PARALLEL_MIN_CHUNK * 3 + 7, 8UL * 1024 * 1024 - 3};
+    for(uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        uint32_t expected = CRC_Compute(&crc, data, lengths[l]);
+
+        for(uint32_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+        {
+            if(CRC_Parallel_Compute(&crc, data, lengths[l], threadCounts[t]) != expected)
+            {
+                printf("FAIL parallel length %llu threads %u\n",
+                    (unsigned long long)lengths[l], threadCounts[t]);
+                errors++;
+            }
+        }
+    }
+
+    // Scaling
+    CRC_x86_Init(&crc, &CRC_MODEL_CRC32, table);
+    uint32_t serial = 0;
+    printf("threads,GB/s,result\n");
+    for(uint32_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+    {
+        double start = Seconds();
+        uint32_t result = CRC_Parallel_Compute(&crc, data, size, threadCounts[t]);
+        double seconds = Seconds() - start;
+
+        if(t == 0)
+            serial = result;
+
+        printf("%u,%.2f,%s\n", threadCounts[t], size / seconds / 1e9,
+            (result == serial) ? "PASS" : "FAIL");
+        if(result != serial)
+            errors++;
+    }
+    free(data);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
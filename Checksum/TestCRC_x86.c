@@ -0,0 +1,111 @@
+/* Program to test and benchmark the x86 hardware CRC paths - MS
+
+   Sets up CRC-32C and CRC-32 with CRC_x86_Init and compares them against
+   the slicing-by-8 table for random lengths (up to a few lanes of the three
+   way CRC-32C) and alignments, all at once and a piece at a time. Then it
+   reports GB/s for the table and the hardware path.
+
+   gcc -O2 TestCRC_x86.c CRC_x86.c CRC.c -o TestCRC_x86
+   ./TestCRC_x86 [benchmarkMegabytes] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "CRC_x86.h"
+
+#define NUM_TESTS           500
+#define MAX_LENGTH          70000
+#define DEFAULT_MEGABYTES   256
+
+static const char *pathNames[] = {"table", "SSE4.2", "PCLMUL"};
+
+static uint32_t hardwareTable[CRC_SLICE8_TABLE_SIZE];
+static uint32_t softwareTable[CRC_SLICE8_TABLE_SIZE];
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int TestModel(const char *name, const CRCModel *model, uint8_t *data, uint32_t benchmarkSize)
+{
+    CRC hardware, software;
+    int errors = 0;
+
+    CRC_x86_Init(&hardware, model, hardwareTable);
+    CRC_Init(&software, model, CRC_METHOD_SLICE8, softwareTable);
+
+    if(CRC_Compute(&hardware, (const uint8_t *)"123456789", 9) != model->check)
+        errors++;
+
+    for(uint32_t i = 0; i < NUM_TESTS; i++)
+    {
+        uint32_t offset = rand() % 16;
+        uint32_t length = (i < 200) ? i : (uint32_t)rand() % MAX_LENGTH;
+        uint32_t expected = CRC_Compute(&software, &data[offset], length);
+
+        if(CRC_Compute(&hardware, &data[offset], length) != expected)
+        {
+            printf("FAIL %s length %u offset %u\n", name, length, offset);
+            errors++;
+        }
+
+        uint32_t done = 0;
+        while(done < length)
+        {
+            uint32_t piece = rand() % 5000;
+            if(piece > length - done)
+                piece = length - done;
+            CRC_Update(&hardware, &data[offset + done], piece);
+            done += piece;
+        }
+        if(CRC_Final(&hardware) != expected)
+        {
+            printf("FAIL %s streaming length %u\n", name, length);
+            errors++;
+        }
+    }
+
+    double start = Seconds();
+    volatile uint32_t result = CRC_Compute(&software, data, benchmarkSize);
+    double tableTime = Seconds() - start;
+
+    start = Seconds();
+    result = CRC_Compute(&hardware, data, benchmarkSize);
+    double hardwareTime = Seconds() - start;
+    (void)result;
+
+    printf("%s,%.2f,%s,%.2f\n", name, benchmarkSize / tableTime / 1e9,
+        pathNames[CRC_x86_GetPath(&hardware)], benchmarkSize / hardwareTime / 1e9);
+    return errors;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t megabytes = DEFAULT_MEGABYTES;
+    int errors = 0;
+
+    if(argc > 1)
+        megabytes = strtoul(argv[1], NULL, 0);
+
+    uint32_t size = megabytes * 1024 * 1024;
+    if(size < MAX_LENGTH + 16)
+        size = MAX_LENGTH + 16;
+
+    uint8_t *data = malloc(size);
+    srand(1234);
+    for(uint32_t i = 0; i < size; i++)
+        data[i] = rand();
+
+    printf("SSE4.2: %s, PCLMUL: %s\n", CRC_x86_HasSSE42() ? "yes" : "no",
+        CRC_x86_HasPCLMUL() ? "yes" : "no");
+    printf("model,table GB/s,path,path GB/s\n");
+    errors += TestModel("CRC-32C", &CRC_MODEL_CRC32C, data, size);
+    errors += TestModel("CRC-32", &CRC_MODEL_CRC32, data, size);
+    free(data);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
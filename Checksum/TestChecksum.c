@@ -0,0 +1,258 @@
+/* Program to test the checksum functions - MS
+
+   Runs random data through each one shot checksum, then through the
+   Init/Update/Final functions in random sized pieces, and makes sure the
+   answers match. Also checks a message bigger than 65535 bytes against a
+   slow reference sum, and that a one's comp checksum with the checksum
+   included comes out to zero. The Fletcher and Adler checksums are checked
+   against published values and a simple reference that does a modulo after
+   every byte, then timed.
+
+   Try it with -DCHECKSUM_USE_SIMD=0 too, to test the unrolled loops.
+
+   gcc -O2 TestChecksum.c Checksum.c -o TestChecksum
+   ./TestChecksum */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Checksum.h"
+
+#define NUM_TESTS       1000
+#define MAX_LENGTH      4096
+#define BIG_LENGTH      1000000UL
+
+static uint8_t data[BIG_LENGTH];
+
+static uint32_t ReferenceFletcher16(const uint8_t *array, uint32_t length)
+{
+    uint32_t a = 0, b = 0;
+
+    for(uint32_t i = 0; i < length; i++)
+    {
+        a = (a + array[i]) % 255;
+        b = (b + a) % 255;
+    }
+    return (b << 8) | a;
+}
+
+static uint32_t ReferenceFletcher32(const uint8_t *array, uint32_t length)
+{
+    uint32_t a = 0, b = 0;
+
+    for(uint32_t i = 0; i < length; i += 2)
+    {
+        uint32_t word = array[i];
+        if(i + 1 < length)
+            word |= (uint32_t)array[i + 1] << 8;
+        a = (a + word) % 65535;
+        b = (b + a) % 65535;
+    }
+    return (b << 16) | a;
+}
+
+static uint32_t ReferenceAdler32(const uint8_t *array, uint32_t length)
+{
+    uint32_t a = 1, b = 0;
+
+    for(uint32_t i = 0; i < length; i++)
+    {
+        a = (a + array[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* Feed the data to an Update function a random sized piece at a time */
+static void UpdateInPieces(ChecksumContext *context,
+    void (*Update)(ChecksumContext *, const uint8_t *, uint32_t),
+    const uint8_t *array, uint32_t length)
+{
+    uint32_t done = 0;
+
+    while(done < length)
+    {
+        uint32_t piece = rand() % 300;
+        if(piece > length - done)
+            piece = length - done;
+        Update(context, &array[done], piece);
+        done += piece;
+    }
+}
+
+int main(void)
+{
+    ChecksumContext context;
+    int errors = 0;
+
+    srand(1234);
+    for(uint32_t i = 0; i < BIG_LENGTH; i++)
+        data[i] = rand();
+
+    for(uint32_t i = 0; i < NUM_TESTS; i++)
+    {
+        uint16_t length = rand() % MAX_LENGTH;
+        const uint8_t *array = &data[rand() % 64];
+
+        Checksum_TwosComp8BitInit(&context);
+        UpdateInPieces(&context, Checksum_TwosComp8BitUpdate, array, length);
+        if(Checksum_TwosComp8BitFinal(&context) != Checksum_TwosComp8Bit(array, length))
+            errors++;
+
+        Checksum_TwosComp16BitInit(&context);
+        UpdateInPieces(&context, Checksum_TwosComp16BitUpdate, array, length);
+        if(Checksum_TwosComp16BitFinal(&context) != Checksum_TwosComp16Bit(array, length))
+            errors++;
+
+        Checksum_OnesComp8BitInit(&context);
+        UpdateInPieces(&context, Checksum_OnesComp8BitUpdate, array, length);
+        if(Checksum_OnesComp8BitFinal(&context) != Checksum_OnesComp8Bit(array, length))
+            errors++;
+
+        Checksum_OnesComp16BitInit(&context);
+        UpdateInPieces(&context, Checksum_OnesComp16BitUpdate, array, length);
+        if(Checksum_OnesComp16BitFinal(&context) != Checksum_OnesComp16Bit(array, length))
+            errors++;
+    }
+    printf("Streaming vs one shot: %s\n", errors ? "FAIL" : "PASS");
+
+    /* A one's comp sum is the sum mod 255 (or 65535), so a 64-bit sum works
+    as a reference. Zero and all ones are the same number in one's comp. */
+    uint64_t reference = 0;
+    for(uint32_t i = 0; i < BIG_LENGTH; i++)
+        reference += data[i];
+
+    Checksum_OnesComp8BitInit(&context);
+    UpdateInPieces(&context, Checksum_OnesComp8BitUpdate, data, BIG_LENGTH);
+    uint8_t result8 = ~Checksum_OnesComp8BitFinal(&context);
+    if(result8 % 255 != reference % 255)
+    {
+        printf("FAIL big 8-bit one's comp\n");
+        errors++;
+    }
+
+    Checksum_OnesComp16BitInit(&context);
+    UpdateInPieces(&context, Checksum_OnesComp16BitUpdate, data, BIG_LENGTH);
+    uint16_t result16 = ~Checksum_OnesComp16BitFinal(&context);
+    if(result16 % 65535 != reference % 65535)
+    {
+        printf("FAIL big 16-bit one's comp\n");
+        errors++;
+    }
+
+    /* Adding the checksum to the data should give zero (or all ones) */
+    for(uint32_t i = 0; i < NUM_TESTS; i++)
+    {
+        uint16_t length = rand() % MAX_LENGTH;
+        uint8_t saved = data[length];
+
+        data[length] = Checksum_OnesComp8Bit(data, length);
+        uint8_t check = Checksum_OnesComp8Bit(data, length + 1);
+        data[length] = saved;
+
+        if(check != 0 && check != 0xFF)
+        {
+            printf("FAIL one's comp 8-bit self check length %u\n", length);
+            errors++;
+        }
+    }
+
+    /* Published values from Wikipedia and zlib */
+    const char *abcde = "abcde", *abcdef = "abcdef", *abcdefgh = "abcdefgh";
+    if(Checksum_Fletcher16((const uint8_t *)abcde, 5) != 0xC8F0 ||
+        Checksum_Fletcher16((const uint8_t *)abcdef, 6) != 0x2057 ||
+        Checksum_Fletcher16((const uint8_t *)abcdefgh, 8) != 0x0627 ||
+        Checksum_Fletcher32((const uint8_t *)abcde, 5) != 0xF04FC729 ||
+        Checksum_Fletcher32((const uint8_t *)abcdef, 6) != 0x56502D2A ||
+        Checksum_Fletcher32((const uint8_t *)abcdefgh, 8) != 0xEBE19591 ||
+        Checksum_Adler32((const uint8_t *)"Wikipedia", 9) != 0x11E60398 ||
+        Checksum_Adler32(NULL, 0) != 1)
+    {
+        printf("FAIL Fletcher/Adler known values\n");
+        errors++;
+    }
+
+    /* All 0xFF is the worst case for overflowing the sums */
+    static uint8_t ones[BIG_LENGTH];
+    memset(ones, 0xFF, sizeof(ones));
+
+    for(uint32_t i = 0; i < 200; i++)
+    {
+        const uint8_t *array = (i & 1) ? ones : &data[rand() % 64];
+        uint32_t length = (i < 100) ? (uint32_t)rand() % MAX_LENGTH : (uint32_t)rand() % (BIG_LENGTH - 64);
+
+        Checksum_Fletcher16Init(&context);
+        UpdateInPieces(&context, Checksum_Fletcher16Update, array, length);
+        if(Checksum_Fletcher16Final(&context) != ReferenceFletcher16(array, length) ||
+            Checksum_Fletcher16(array, length) != ReferenceFletcher16(array, length))
+        {
+            printf("FAIL Fletcher-16 length %u\n", length);
+            errors++;
+        }
+
+        Checksum_Fletcher32Init(&context);
+        UpdateInPieces(&context, Checksum_Fletcher32Update, array, length);
+        if(Checksum_Fletcher32Final(&context) != ReferenceFletcher32(array, length) ||
+            Checksum_Fletcher32(array, length) != ReferenceFletcher32(array, length))
+        {
+            printf("FAIL Fletcher-32 length %u\n", length);
+            errors++;
+        }
+
+        Checksum_Adler32Init(&context);
+        UpdateInPieces(&context, Checksum_Adler32Update, array, length);
+        if(Checksum_Adler32Final(&context) != ReferenceAdler32(array, length) ||
+            Checksum_Adler32(array, length) != ReferenceAdler32(array, length))
+        {
+            printf("FAIL Adler-32 length %u\n", length);
+            errors++;
+        }
+    }
+
+    /* The real worst case for Fletcher-32 is both sums at 65534 going into a
+    block of all 0xFFFF words. A block of 359 zeros then 0xFFFE gets them
+    there, and the next 360 words take the second sum to just under 2^32. */
+    static uint8_t worst[720 * 2];
+    memset(worst, 0, 360 * 2);
+    memset(&worst[360 * 2], 0xFF, 360 * 2);
+    worst[359 * 2] = 0xFE;
+    worst[359 * 2 + 1] = 0xFF;
+    if(Checksum_Fletcher32(worst, sizeof(worst)) != ReferenceFletcher32(worst, sizeof(worst)))
+    {
+        printf("FAIL Fletcher-32 worst case\n");
+        errors++;
+    }
+
+    // Speed, 100 passes over the big buffer
+    volatile uint32_t result = 0;
+    double start = Seconds();
+    for(uint32_t i = 0; i < 100; i++)
+        result += Checksum_TwosComp16Bit(data, 65535);
+    printf("TwosComp16Bit: %.2f GB/s\n", 100 * 65535 / (Seconds() - start) / 1e9);
+
+    start = Seconds();
+    for(uint32_t i = 0; i < 100; i++)
+        result += Checksum_Fletcher16(data, BIG_LENGTH);
+    printf("Fletcher16:    %.2f GB/s\n", 100 * BIG_LENGTH / (Seconds() - start) / 1e9);
+
+    start = Seconds();
+    for(uint32_t i = 0; i < 100; i++)
+        result += Checksum_Fletcher32(data, BIG_LENGTH);
+    printf("Fletcher32:    %.2f GB/s\n", 100 * BIG_LENGTH / (Seconds() - start) / 1e9);
+
+    start = Seconds();
+    for(uint32_t i = 0; i < 100; i++)
+        result += Checksum_Adler32(data, BIG_LENGTH);
+    printf("Adler32:       %.2f GB/s\n", 100 * BIG_LENGTH / (Seconds() - start) / 1e9);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,130 @@
+/* Program to test and benchmark the Internet checksum - MS
+
+   Checks the example from RFC 1071, then compares Checksum_Internet16Bit
+   against a simple big endian word loop for random lengths and alignments,
+   both all at once and a piece at a time. Last, it compares the speed in
+   GB/s against the byte loop in Checksum_OnesComp16Bit on 64 KB blocks,
+   since that one can't take more than 65535 bytes.
+
+   Build it a few ways to try each path:
+   gcc -O2 TestInternetChecksum.c Checksum.c -o TestInternetChecksum
+   gcc -O2 -mavx2 TestInternetChecksum.c Checksum.c -o TestInternetChecksum
+   gcc -O2 -DCHECKSUM_USE_SIMD=0 TestInternetChecksum.c Checksum.c -o TestInternetChecksum
+   ./TestInternetChecksum [benchmarkMegabytes] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Checksum.h"
+
+#define NUM_TESTS           2000
+#define MAX_LENGTH          3000
+#define BLOCK_SIZE          65535
+#define DEFAULT_MEGABYTES   256
+
+static uint16_t Reference(const uint8_t *array, uint32_t length)
+{
+    uint32_t sum = 0;
+
+    for(uint32_t i = 0; i + 1 < length; i += 2)
+        sum += (uint32_t)array[i] << 8 | array[i + 1];
+
+    if(length & 1)
+        sum += (uint32_t)array[length - 1] << 8;
+
+    while(sum >> 16)
+        sum = (sum & 0xFFFF) + (sum >> 16);
+
+    return (uint16_t)~sum;
+}
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    const uint8_t rfcExample[] = {0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7};
+    static uint8_t data[MAX_LENGTH + 64];
+    uint32_t megabytes = DEFAULT_MEGABYTES;
+    ChecksumContext context;
+    int errors = 0;
+
+    if(argc > 1)
+        megabytes = strtoul(argv[1], NULL, 0);
+
+    /* RFC 1071 section 3 adds these up to 0xDDF2 */
+    if(Checksum_Internet16Bit(rfcExample, sizeof(rfcExample)) != (uint16_t)~0xDDF2)
+    {
+        printf("FAIL RFC 1071 example\n");
+        errors++;
+    }
+
+    srand(1234);
+    for(uint32_t i = 0; i < sizeof(data); i++)
+        data[i] = rand();
+
+    for(uint32_t i = 0; i < NUM_TESTS; i++)
+    {
+        uint32_t length = rand() % MAX_LENGTH;
+        const uint8_t *array = &data[rand() % 64];
+        uint16_t expected = Reference(array, length);
+
+        if(Checksum_Internet16Bit(array, length) != expected)
+        {
+            printf("FAIL length %u\n", length);
+            errors++;
+        }
+
+        uint32_t done = 0;
+        Checksum_Internet16BitInit(&context);
+        while(done < length)
+        {
+            uint32_t piece = rand() % 100;
+            if(piece > length - done)
+                piece = length - done;
+            Checksum_Internet16BitUpdate(&context, &array[done], piece);
+            done += piece;
+        }
+        if(Checksum_Internet16BitFinal(&context) != expected)
+        {
+            printf("FAIL streaming length %u\n", length);
+            errors++;
+        }
+    }
+
+    // Benchmark
+    uint32_t numBlocks = megabytes * 1024 * 1024 / BLOCK_SIZE;
+    uint8_t *big = malloc((size_t)numBlocks * BLOCK_SIZE + 1);
+    for(uint32_t i = 0; i < numBlocks * BLOCK_SIZE; i++)
+        big[i] = (uint8_t)(i * 2654435761UL >> 24);
+
+    volatile uint16_t result = 0;
+    double start = Seconds();
+    for(uint32_t i = 0; i < numBlocks; i++)
+        result += Checksum_OnesComp16Bit(&big[(size_t)i * BLOCK_SIZE], BLOCK_SIZE);
+    double byteLoop = Seconds() - start;
+
+    start = Seconds();
+    for(uint32_t i = 0; i < numBlocks; i++)
+        result += Checksum_Internet16Bit(&big[(size_t)i * BLOCK_SIZE], BLOCK_SIZE);
+    double wordLoop = Seconds() - start;
+
+    /* Same thing, but one byte off so none of the loads are aligned */
+    start = Seconds();
+    for(uint32_t i = 0; i < numBlocks; i++)
+        result += Checksum_Internet16Bit(&big[(size_t)i * BLOCK_SIZE + 1], BLOCK_SIZE - 1);
+    double unaligned = Seconds() - start;
+    free(big);
+
+    double gigabytes = (double)numBlocks * BLOCK_SIZE / 1e9;
+    printf("Checksum_OnesComp16Bit:             %6.2f GB/s\n", gigabytes / byteLoop);
+    printf("Checksum_Internet16Bit:             %6.2f GB/s\n", gigabytes / wordLoop);
+    printf("Checksum_Internet16Bit (unaligned): %6.2f GB/s\n", gigabytes / unaligned);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
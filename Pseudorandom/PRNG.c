@@ -6,6 +6,14 @@
  * @author Matthew Spinks <https://github.com/mspinksosu>
  * 
  * @date 9/23/23   Original creation
+ * @date 10/16/26  Added PRNG_Fill
+ * @date 10/16/26  Added PRNG_SplitStreams
+ * @date 10/16/26  Added PCG32, xoshiro256**, and SplitMix64
+ * @date 10/16/26  Bounded numbers use Lemire's method. Added PRNG_FillBounded
+ * @date 10/16/26  Faster shuffle. Added index shuffle and PRNG_Permute
+ * @date 10/16/26  Step functions moved to PRNG_Static.h for PRNG_DEFINE
+ * @date 10/16/26  Added floats, doubles, and normal numbers with a ziggurat
+ * @date 10/16/26  Fixed Park Miller skipping backwards
  * 
  * @details
  *      The values of a and m for the LCG's and the big Park Miller LCG were 
@@ -27,49 +35,41 @@
  ******************************************************************************/
 
 #include "PRNG.h"
+#include "PRNG_Static.h"
+#include "PRNG_Ziggurat.h"
 #include "string.h"
+#include <math.h>
 
 // ***** Defines ***************************************************************
 
-/* Using this LCG requires 64-bit math. Modulus m is power of two */
-#define LCG_BIG_M               (1ULL << 63)
-#define LCG_BIG_MASK            (LCG_BIG_M - 1ULL)
-#define LCG_BIG_A               3249286849523012805ULL
-/* m and c must be relatively prime, so c = 1 is commonly chosen */
-#define LCG_BIG_C               1ULL
-#define LCG_BIG_DEFAULT_SEED    1ULL
-
-/* Modulus m is power of two */
-#define LCG_SMALL_M             (1UL << 31)
-#define LCG_SMALL_MASK          (LCG_SMALL_M - 1UL)
-#define LCG_SMALL_A             20501397UL
-/* m and c must be relatively prime, so c = 1 is commonly chosen */
-#define LCG_SMALL_C             1UL
-#define LCG_SMALL_DEFAULT_SEED  1UL
-
 /* For the Park Miller, modulus m is chosen to be a prime number. */
 #define PM_BIGGER_M             ((1ULL << 63) - 25ULL)
 #define PM_BIGGER_A             6458928179451363983ULL
 
-/* Prime numbers that are closer to the maximum value for a given bit size tend 
-to work better. The 8th Mersenne prime is often chosen for m because it is very 
-close to 2^32. It is also the default value for C++ minstd_rand */
-#define PM_BIG_M                ((1UL << 31) - 1UL)
-#define PM_BIG_A                48271UL
+/* The shuffle works out this many random indexes at a time, so that it can 
+look ahead and ask for the elements it is about to swap before it needs them. 
+Each one takes 4 bytes of stack. */
+#define SHUFFLE_BATCH_SIZE      256
+#define SHUFFLE_PREFETCH        16
+
+/* Elements bigger than this are swapped a piece at a time */
+#define SWAP_CHUNK_SIZE         64
+#define CACHE_LINE_SIZE         64
 
-/* For a mulplicative LCG like the Park Miller, the initial value X_0 must be 
-relatively prime to m. If m is chosen to be a prime number, then any value 
-from 0 < X_0 < m will work. */
-#define PM_DEFAULT_SEED         1UL
+/* PRNG_Permute marks elements that are already in place with the top bit */
+#define PERMUTE_DONE            0x80000000UL
 
-/* Precomputed values for Schrage's method. I will use the same multiplier and 
-modulus as the 32-bit Park Miller */
-#define SCH_M                   ((1UL << 31) - 1UL)
-#define SCH_A                   48271UL
-#define SCH_Q                   44488 // Q = M / A
-#define SCH_R                   3399  // R = M % A
+/* A float has 24 bits of mantissa and a double has 53. A random integer with 
+that many bits times 2^-24 or 2^-53 fills every one of them, and the compiler 
+works out the constant, so there is no division. */
+#define FLOAT_SCALE             (1.0f / 16777216.0f)
+#define DOUBLE_SCALE            (1.0 / 9007199254740992.0)
 
-#define DEBUG_PRINT             true
+/* The float and normal fills make this many 64-bit numbers at a time. Each 
+one takes 8 bytes of stack. */
+#define FLOAT_BATCH_SIZE        128
+
+#define DEBUG_PRINT             false
 
 #if DEBUG_PRINT
 #include <stdio.h>
@@ -77,9 +77,64 @@ modulus as the 32-bit Park Miller */
 
 // ***** Global Variables ******************************************************
 
+/* Where the ziggurat gets its random numbers from. Made in batches for the 
+fill, one at a time for PRNG_NextNormal. */
+typedef struct PRNGDrawsTag
+{
+    PRNG *prng;
+    uint32_t buffer[2 * FLOAT_BATCH_SIZE];
+    size_t next;
+    size_t count;
+    size_t numLeft;
+} PRNGDraws;
 
 // ***** Static Functions Prototypes *******************************************
 
+static void FillLCGBig(uint64_t *state, uint32_t *out, size_t n);
+static void FillLCGSmall(uint32_t *state, uint32_t *out, size_t n);
+static void FillParkMiller(uint64_t *state, uint32_t *out, size_t n);
+static void Xoshiro256_Polynomial(uint64_t *state, const uint64_t *poly);
+static void Polynomial_TimesX(uint64_t *poly);
+static void Polynomial_Square(uint64_t *poly);
+static uint32_t Next32(PRNG *self);
+static uint32_t Bounded(PRNG *self, uint32_t range);
+static void FillLemire(PRNG *self, uint32_t *out, size_t n, uint32_t range, uint32_t lower,
+    bool countDown);
+static void Fill64(PRNG *self, uint32_t *out, size_t n);
+static uint64_t Draw64(PRNGDraws *draws);
+static double Normal(PRNGDraws *draws);
+static inline void Swap(uint8_t *a, uint8_t *b, size_t s);
+static inline void Prefetch(const uint8_t *element, size_t s);
+
+/* The characteristic polynomial of the xoshiro256 linear engine, without the 
+x^256 term. Stepping the state n times is the same as multiplying by x^n mod 
+this polynomial. It was found with the Berlekamp-Massey algorithm, and checked 
+by making sure that x^(2^128) and x^(2^192) give the jump polynomials below. */
+static const uint64_t xoshiro256CharPoly[4] = {
+    0x9D116F2BB0F0F001ULL, 0x0280002BCEFD1A5EULL,
+    0x04B4EDCF26259F85ULL, 0x0003C03C3F3ECB19ULL };
+
+/* Jump polynomials from the xoshiro256** reference code. x^(2^128) and 
+x^(2^192) mod the characteristic polynomial. */
+static const uint64_t xoshiro256Jump[4] = {
+    0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+    0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+static const uint64_t xoshiro256LongJump[4] = {
+    0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+    0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+
+/* The ziggurat tables for PRNG_NextNormal. See PRNG_Ziggurat.h */
+static const uint64_t zigguratK[PRNG_ZIGGURAT_SIZE] = PRNG_ZIGGURAT_K;
+static const double zigguratW[PRNG_ZIGGURAT_SIZE] = PRNG_ZIGGURAT_W;
+static const double zigguratF[PRNG_ZIGGURAT_SIZE] = PRNG_ZIGGURAT_F;
+
+// *****************************************************************************
+
+void PRNG_Create(PRNG *self, PRNGType type)
+{
+    self->type = type;
+    self->isSeeded = false;
+}
 
 // *****************************************************************************
 
@@ -101,9 +156,30 @@ void PRNG_Seed(PRNG *self, uint32_t seed)
             case PRNG_TYPE_SCHRAGE:
                 seed = PM_DEFAULT_SEED;
                 break;
+            case PRNG_TYPE_PCG32:
+                seed = PCG32_DEFAULT_SEED;
+                break;
+            case PRNG_TYPE_XOSHIRO256:
+                seed = XOSHIRO256_DEFAULT_SEED;
+                break;
+            case PRNG_TYPE_SPLITMIX64:
+                seed = SPLITMIX64_DEFAULT_SEED;
+                break;
         }
     }
-    self->state.u64 = seed;
+
+    switch(self->type)
+    {
+        case PRNG_TYPE_PCG32:
+            PCG32_SeedInline(&(self->state.u64), seed);
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            Xoshiro256_SeedInline(self->state.u64x4, seed);
+            break;
+        default:
+            self->state.u64 = seed;
+            break;
+    }
     self->isSeeded = true;
 }
 
@@ -130,6 +206,15 @@ uint32_t PRNG_Next(PRNG *self)
         case PRNG_TYPE_SCHRAGE:
             result = Schrage_Next(&(self->state.u32));
             break;
+        case PRNG_TYPE_PCG32:
+            result = PCG32_Next(&(self->state.u64));
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            result = Xoshiro256_Next(self->state.u64x4) >> 32;
+            break;
+        case PRNG_TYPE_SPLITMIX64:
+            result = SplitMix64_Next(&(self->state.u64)) >> 32;
+            break;
     }
     return result;
 }
@@ -138,9 +223,26 @@ uint32_t PRNG_Next(PRNG *self)
 
 uint32_t PRNG_NextBounded(PRNG *self, uint32_t lower, uint32_t upper)
 {
-    uint32_t result = 0;
-    uint32_t randMax = 0xFFFFFFFF;
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    if(lower > upper)
+    {
+        uint32_t temp = lower;
+        lower = upper;
+        upper = temp;
+    }
+
+    /* If the range is all 32 bits, it wraps around to 0 */
+    uint32_t range = upper - lower + 1;
+
+    return Bounded(self, range) + lower;
+}
 
+// *****************************************************************************
+
+void PRNG_FillBounded(PRNG *self, uint32_t *out, size_t n, uint32_t lower, uint32_t upper)
+{
     if(!self->isSeeded)
         PRNG_Seed(self, 0);
 
@@ -148,55 +250,126 @@ uint32_t PRNG_NextBounded(PRNG *self, uint32_t lower, uint32_t upper)
     {
         uint32_t temp = lower;
         lower = upper;
-        upper = lower;
+        upper = temp;
     }
 
-    switch(self->type)
+    uint32_t range = upper - lower + 1;
+
+    /* The full range wraps around to 0. The numbers are used as is. */
+    if(range == 0 && self->type != PRNG_TYPE_LCG_SMALL &&
+        self->type != PRNG_TYPE_PARK_MILLER && self->type != PRNG_TYPE_SCHRAGE)
     {
-        case PRNG_TYPE_LCG_BIG:
-            randMax = 0xFFFFFFFF;
-            break;
-        case PRNG_TYPE_LCG_SMALL:
-            randMax = LCG_SMALL_M;
-            break;
-        case PRNG_TYPE_PARK_MILLER:
-            randMax = PM_BIG_M;
-            break;
-        case PRNG_TYPE_SCHRAGE:
-            randMax = SCH_M;
-            break;
+        PRNG_Fill(self, out, n);
+        return;
     }
 
-    /* output = output % (upper - lower + 1) + min */
-    uint32_t range = upper - lower;
-    if(range < 0xFFFFFFFF)
-        range++;
+    FillLemire(self, out, n, range, lower, false);
+}
 
-    /* method for removing modulo bias */
-    uint32_t threshold = randMax - randMax % range;
-    do {
-        switch(self->type)
-        {
-            case PRNG_TYPE_LCG_BIG:
-                result = LCGBig_Next(&(self->state.u64));
-                break;
-            case PRNG_TYPE_LCG_SMALL:
-                result = LCGSmall_Next(&(self->state.u32));
-                break;
-            case PRNG_TYPE_PARK_MILLER:
-                result = ParkMiller_Next(&(self->state.u64));
-                break;
-            case PRNG_TYPE_SCHRAGE:
-                result = Schrage_Next(&(self->state.u32));
-                break;
-        }
-    } while(result >= threshold);
+// *****************************************************************************
+
+float PRNG_NextFloat01(PRNG *self)
+{
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    /* The top 24 bits. Dividing by 2^32 instead would round some of the 
+    bigger numbers up to 1.0 */
+    return (Next32(self) >> 8) * FLOAT_SCALE;
+}
+
+// *****************************************************************************
+
+double PRNG_NextDouble01(PRNG *self)
+{
+    uint32_t temp[2];
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    Fill64(self, temp, 1);
+    return ((((uint64_t)temp[0] << 32) | temp[1]) >> 11) * DOUBLE_SCALE;
+}
+
+// *****************************************************************************
+
+double PRNG_NextNormal(PRNG *self, double mean, double stdDev)
+{
+    PRNGDraws draws;
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    draws.prng = self;
+    draws.next = draws.count = 0;
+    draws.numLeft = 1;
+
+    return Normal(&draws) * stdDev + mean;
+}
+
+// *****************************************************************************
+
+void PRNG_FillFloat01(PRNG *self, float *out, size_t n)
+{
+    uint32_t temp[2 * FLOAT_BATCH_SIZE];
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    if(self->type == PRNG_TYPE_LCG_SMALL || self->type == PRNG_TYPE_PARK_MILLER ||
+        self->type == PRNG_TYPE_SCHRAGE)
+    {
+        for(size_t i = 0; i < n; i++)
+            out[i] = (Next32(self) >> 8) * FLOAT_SCALE;
+        return;
+    }
+
+    for(size_t i = 0; i < n; i += 2 * FLOAT_BATCH_SIZE)
+    {
+        size_t count = (n - i < 2 * FLOAT_BATCH_SIZE) ? n - i : 2 * FLOAT_BATCH_SIZE;
+
+        PRNG_Fill(self, temp, count);
+        for(size_t k = 0; k < count; k++)
+            out[i + k] = (temp[k] >> 8) * FLOAT_SCALE;
+    }
+}
+
+// *****************************************************************************
+
+void PRNG_FillDouble01(PRNG *self, double *out, size_t n)
+{
+    uint32_t temp[2 * FLOAT_BATCH_SIZE];
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    for(size_t i = 0; i < n; i += FLOAT_BATCH_SIZE)
+    {
+        size_t count = (n - i < FLOAT_BATCH_SIZE) ? n - i : FLOAT_BATCH_SIZE;
+
+        Fill64(self, temp, count);
+        for(size_t k = 0; k < count; k++)
+            out[i + k] = ((((uint64_t)temp[2 * k] << 32) | temp[2 * k + 1]) >> 11) * DOUBLE_SCALE;
+    }
+}
+
+// *****************************************************************************
+
+void PRNG_FillNormal(PRNG *self, double *out, size_t n, double mean, double stdDev)
+{
+    PRNGDraws draws;
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
 
-    return (result % range) + lower;
+    draws.prng = self;
+    draws.next = draws.count = 0;
 
-    /* @note I tested the modulo bias removal method above against the naive 
-    method (just using % by itself), and I haven't seen a difference yet. 
-    Maybe it only makes a difference for very large values? Not sure. - MS */
+    for(size_t i = 0; i < n; i++)
+    {
+        draws.numLeft = n - i;
+        out[i] = Normal(&draws) * stdDev + mean;
+    }
 }
 
 // *****************************************************************************
@@ -226,68 +399,254 @@ uint32_t PRNG_Skip(PRNG *self, int64_t n)
             the output. - MS */
             result = ParkMiller_Skip(&(self->state.u64), n);
             break;
+        case PRNG_TYPE_PCG32:
+            result = PCG32_Skip(&(self->state.u64), n);
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            result = Xoshiro256_Skip(self->state.u64x4, n) >> 32;
+            break;
+        case PRNG_TYPE_SPLITMIX64:
+            result = SplitMix64_Skip(&(self->state.u64), n) >> 32;
+            break;
     }
     return result;
 }
 
 // *****************************************************************************
 
-void PRNG_Shuffle(void *array, uint32_t n, size_t s, uint32_t seed)
+void PRNG_Fill(PRNG *self, uint32_t *out, size_t n)
 {
-    uint8_t tmp[s];
-    uint8_t *arrayPtr = array;
-    uint32_t schrageState = seed;
+    uint64_t temp;
 
-    if(schrageState == 0)
-        schrageState++;
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
 
     if(n == 0)
-        n++;
+        return;
+
+    switch(self->type)
+    {
+        case PRNG_TYPE_LCG_BIG:
+            FillLCGBig(&(self->state.u64), out, n);
+            break;
+        case PRNG_TYPE_LCG_SMALL:
+            FillLCGSmall(&(self->state.u32), out, n);
+            break;
+        case PRNG_TYPE_PARK_MILLER:
+            FillParkMiller(&(self->state.u64), out, n);
+            break;
+        case PRNG_TYPE_SCHRAGE:
+            /* The seed could be bigger than m, so the first step has to be 
+            done the Schrage way. After that the state is always less than m, 
+            and Schrage's method gives the exact same sequence as the Park 
+            Miller. */
+            out[0] = Schrage_Next(&(self->state.u32));
+            temp = self->state.u32;
+            FillParkMiller(&temp, out + 1, n - 1);
+            self->state.u32 = (uint32_t)temp;
+            break;
+        /* The newer generators don't have lanes yet. At least skip the 
+        switch on every number. */
+        case PRNG_TYPE_PCG32:
+            for(size_t i = 0; i < n; i++)
+                out[i] = PCG32_Next(&(self->state.u64));
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            for(size_t i = 0; i < n; i++)
+                out[i] = Xoshiro256_Next(self->state.u64x4) >> 32;
+            break;
+        case PRNG_TYPE_SPLITMIX64:
+            for(size_t i = 0; i < n; i++)
+                out[i] = SplitMix64_Next(&(self->state.u64)) >> 32;
+            break;
+    }
+}
+
+// *****************************************************************************
+
+void PRNG_SplitStreams(PRNG *parent, uint32_t k, PRNG *streams, uint64_t blockLength)
+{
+    uint64_t period = 0;
+
+    if(!parent->isSeeded)
+        PRNG_Seed(parent, 0);
+
+    if(k == 0)
+        return;
+
+    /* The Park Miller never outputs 0, so its period is m - 1 */
+    switch(parent->type)
+    {
+        case PRNG_TYPE_LCG_BIG:
+            period = LCG_BIG_M;
+            break;
+        case PRNG_TYPE_LCG_SMALL:
+            period = LCG_SMALL_M;
+            break;
+        case PRNG_TYPE_PARK_MILLER:
+            period = PM_BIG_M - 1;
+            break;
+        case PRNG_TYPE_SCHRAGE:
+            period = SCH_M - 1;
+            break;
+        case PRNG_TYPE_PCG32:
+        case PRNG_TYPE_SPLITMIX64:
+            /* The period is 2^64, which is 0 in a uint64_t. The skip math 
+            wraps around at 2^64 anyway. */
+            period = 0;
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            /* The period is 2^256 - 1. Too big to divide up, so give each 
+            stream its own 2^128 numbers with the jump function instead. */
+            if(blockLength == 0)
+            {
+                for(uint32_t i = 0; i < k; i++)
+                {
+                    streams[i] = (i == 0) ? *parent : streams[i - 1];
+                    if(i > 0)
+                        Xoshiro256_Jump(streams[i].state.u64x4);
+                }
+                return;
+            }
+            break;
+    }
+
+    if(blockLength == 0)
+        blockLength = (period == 0) ? UINT64_MAX / k : period / k;
 
-    for(uint32_t i = n - 1; i > 0; i--)
+    /* Block splitting. The leapfrog method (stream i gets every kth number) 
+    would need a different multiplier for each stream, and my PRNG object 
+    only keeps the state. Skipping ahead to the start of each block only 
+    needs the state, and it only costs O(log2(n)) per stream. */
+    for(uint32_t i = 0; i < k; i++)
     {
-        // Pick a random index from 0 to i
-        uint32_t j = Schrage_Next(&schrageState) % (i + 1); // TODO should I replace this with the "modulo bias removal method" like above?
+        streams[i] = *parent;
+        uint64_t offset = blockLength * i;
+        if(period != 0)
+            offset %= period;
+        PRNG_Skip(&streams[i], (int64_t)offset);
+    }
+}
+
+// *****************************************************************************
+
+void PRNG_Shuffle(void *array, uint32_t n, size_t s, uint32_t seed)
+{
+    PRNG prng;
+
+    /* PCG32 gives a full 32 bits per number, so each index only costs one 
+    call. Seed 0 is changed to the default by PRNG_Seed. */
+    PRNG_Create(&prng, PRNG_TYPE_PCG32);
+    PRNG_Seed(&prng, seed);
+    PRNG_ShuffleArray(&prng, array, n, s);
+}
 
-        // Swap arr[i] with the element at the random index (j)
-        memcpy(tmp, arrayPtr + j * s, s);
-        memcpy(arrayPtr + j * s, arrayPtr + i * s, s);
-        memcpy(arrayPtr + i * s, tmp, s);
+// *****************************************************************************
+
+void PRNG_ShuffleArray(PRNG *self, void *array, uint32_t n, size_t s)
+{
+    uint32_t index[SHUFFLE_BATCH_SIZE];
+    uint8_t *arrayPtr = array;
+
+    if(!self->isSeeded)
+        PRNG_Seed(self, 0);
+
+    /* Fisher-Yates, from the back. Element i is swapped with a random 
+    element from 0 to i. Instead of picking one index at a time, pick a batch 
+    of them. On a big array, almost every swap is a cache miss, so ask for 
+    the elements a few swaps ahead of time. Then the memory can work on 
+    several of them at once instead of waiting on each one. */
+    for(uint32_t i = (n > 0) ? n - 1 : 0; i > 0;)
+    {
+        uint32_t count = (i < SHUFFLE_BATCH_SIZE) ? i : SHUFFLE_BATCH_SIZE;
+
+        FillLemire(self, index, count, i + 1, 0, true);
+
+        for(uint32_t k = 0; k < count; k++)
+        {
+            if(k + SHUFFLE_PREFETCH < count)
+                Prefetch(arrayPtr + (size_t)index[k + SHUFFLE_PREFETCH] * s, s);
+            Swap(arrayPtr + (size_t)(i - k) * s, arrayPtr + (size_t)index[k] * s, s);
+        }
+        i -= count;
     }
 }
 
 // *****************************************************************************
 
-uint32_t LCGBig_Next(uint64_t *state)
+void PRNG_ShuffleIndex(PRNG *self, uint32_t *index, uint32_t n)
+{
+    for(uint32_t i = 0; i < n; i++)
+        index[i] = i;
+
+    PRNG_ShuffleArray(self, index, n, sizeof(uint32_t));
+}
+
+// *****************************************************************************
+
+void PRNG_Permute(void *array, uint32_t *index, uint32_t n, size_t s)
 {
-    /* This version will use a power of two for the modulus for speed with
-    the lower bits removed. Similar to C rand, but with 32-bit result. 
-    Multiplier a will be chosen from L'Ecuyer research paper. Increment c 
-    will need to be odd. Try with c = 1. */
+    uint8_t *arrayPtr = array;
+
+    /* Element k gets whatever was at index[k]. Every permutation is made of 
+    cycles: k takes from index[k], which takes from index[index[k]], and so 
+    on until it comes back around to k. Walk around each cycle, swapping each 
+    spot with the one it takes from. The element that started at k gets 
+    carried along until it lands in the last spot of the cycle. Each element 
+    only has to come in from memory once, since the spot that was just 
+    swapped into is the next one to be swapped out of. Walking a cycle is 
+    like following a linked list, so a second spot runs a few steps ahead 
+    and asks for those elements before they are needed. The top bit marks 
+    the ones that are done, and it is cleared at the end so the index array 
+    is left as it was. */
+    for(uint32_t start = 0; start < n; start++)
+    {
+        uint32_t k = start;
+        uint32_t ahead = start;
 
-    /* TODO Possible output values should be in the range 0 to 2^32-1. But 
-    output is not full-cycle. Need to verify. */
+        if(index[k] & PERMUTE_DONE)
+            continue;
+
+        for(uint32_t i = 0; i < SHUFFLE_PREFETCH && index[ahead] != start; i++)
+        {
+            ahead = index[ahead];
+            Prefetch(arrayPtr + (size_t)ahead * s, s);
+        }
+
+        while(index[k] != start)
+        {
+            uint32_t next = index[k];
+
+            if(index[ahead] != start)
+            {
+                ahead = index[ahead];
+                Prefetch(arrayPtr + (size_t)ahead * s, s);
+            }
+            Swap(arrayPtr + (size_t)k * s, arrayPtr + (size_t)next * s, s);
+            index[k] |= PERMUTE_DONE;
+            k = next;
+        }
+        index[k] |= PERMUTE_DONE;
+    }
 
-    /* X_n+1 = (a * X_n + c) % m */
-    *state = (LCG_BIG_A * (*state) + LCG_BIG_C) & LCG_BIG_MASK;
-    return (uint32_t)(*state >> 30ULL); // bits[62:31]
+    for(uint32_t i = 0; i < n; i++)
+        index[i] &= ~PERMUTE_DONE;
 }
 
 // *****************************************************************************
 
-uint16_t LCGSmall_Next(uint32_t *state)
+uint32_t LCGBig_Next(uint64_t *state)
 {
-    /* This version is similar to C rand. I will use a power of two for 
-    the modulus for speed with the lower bits removed. Multiplier a will be 
-    chosen from L'Ecuyer research paper. Increment c needs to be odd. I will 
-    use c = 1. */
+    /* The step itself is in PRNG_Static.h, so that PRNG_DEFINE can inline 
+    it */
+    return LCGBig_NextInline(state);
+}
 
-    /* TODO Possible output values should be in the range 0 to 2^16-1. But 
-    output is not full-cycle. Need to verify. */
+// *****************************************************************************
 
-    /* X_n+1 = (a * X_n + c) % m */
-    *state = (LCG_SMALL_A * (*state) + LCG_SMALL_C) & LCG_SMALL_MASK;
-    return (uint16_t)(*state >> 15ULL); // bits[30:15]
+uint16_t LCGSmall_Next(uint32_t *state)
+{
+    return LCGSmall_NextInline(state);
 }
 
 // *****************************************************************************
@@ -413,14 +772,7 @@ uint16_t LCGSmall_Skip(uint32_t *state, int32_t n)
 
 uint32_t ParkMiller_Next(uint64_t *state)
 {
-    /* TODO Add more notes
-    This version will be a full-cycle PRNG with a modulus of a prime 
-    number and c = 0. I believe the output values should be in the range of 
-    1 to m - 1. */
-
-    /* X_n+1 = (a * X_n) % m */
-    *state = (PM_BIG_A * (*state)) % PM_BIG_M;
-    return *state;
+    return ParkMiller_NextInline(state);
 }
 
 // *****************************************************************************
@@ -450,11 +802,11 @@ uint32_t ParkMiller_Skip(uint64_t *state, int64_t n)
 
     /* Compute i (number of times to skip ahead). If i is negative, add the 
     period until it is positive. Skipping backwards is the same as skipping 
-    forwards that many times. */
-    int64_t i = n;
-    while(i < 0)
-        i += PM_BIG_M;
-    i = i % PM_BIG_M;
+    forwards that many times. The period is m - 1, not m, because the state 
+    can never be 0. */
+    int64_t i = n % (int64_t)(PM_BIG_M - 1);
+    if(i < 0)
+        i += PM_BIG_M - 1;
 
     uint64_t A = 1, h = PM_BIG_A;
 #if DEBUG_PRINT
@@ -484,29 +836,582 @@ uint32_t ParkMiller_Skip(uint64_t *state, int64_t n)
 
 uint32_t Schrage_Next(uint32_t *state)
 {
-    int32_t result;
-    uint32_t X = *state;
-    int32_t X_Div_Q, X_Mod_Q;
-    /* Schrage's method is a version of a Park Miller that avoids the need to 
-    use a 64-bit variable to store the product of a * x. For any integer "m" 
-    and "a > 0" there exists unique integers "q" (quotient) and "r" (remainder) 
-    such that "m = a * q + r" and "0 <= r < m". 
-    
-    "q = m / a" (integer division) and "r = m % a". We compute the product 
-    a * x by the approximation: a * x = a(x % q) - r[x / q] (integer division).
-    Then take the result and perform % m to it. This modulo m is further 
-    simplified: if a * x = a(x % q) - r[x / q] is negative, m is added to it. */
-
-    /* ax % m = a(x % q) - r[x / q] % m 
-    For X_Mod_Q, since we already have x / q, x % q can easily be done without 
-    doing any actual modulo division. */
-    X_Div_Q = X / SCH_Q;
-    X_Mod_Q = X - X_Div_Q * SCH_Q;
-    result = SCH_A * X_Mod_Q - SCH_R * X_Div_Q;
-    if(result < 0)
-        result += SCH_M;
-
-    return *state = (uint32_t)result;
+    return Schrage_NextInline(state);
+}
+
+// *****************************************************************************
+
+uint32_t PCG32_Next(uint64_t *state)
+{
+    return PCG32_NextInline(state);
+}
+
+// *****************************************************************************
+
+uint32_t PCG32_Skip(uint64_t *state, int64_t n)
+{
+    /* This is the same as my big LCG skip ahead, except that the modulus is 
+    2^64, so there's nothing to mask off. Going backwards works by letting the 
+    number wrap around.
+
+    The output comes from the state before the step, so the nth number is 
+    found by skipping ahead n - 1 and then taking one more step. */
+    uint64_t i = (uint64_t)(n - 1);
+    uint64_t A = 1, h = PCG32_A, C = 0, f = PCG32_C;
+
+    for(; i > 0; i >>= 1)
+    {
+        if(i & 1)
+        {
+            A = A * h;
+            C = C * h + f;
+        }
+        f = f * h + f;
+        h = h * h;
+    }
+    *state = A * (*state) + C;
+    return PCG32_Next(state);
+}
+
+// *****************************************************************************
+
+uint64_t Xoshiro256_Next(uint64_t *state)
+{
+    return Xoshiro256_NextInline(state);
+}
+
+// *****************************************************************************
+
+uint64_t Xoshiro256_Skip(uint64_t *state, int64_t n)
+{
+    /* There's no formula like the LCG's have, but the engine is linear over 
+    GF(2) (just XOR's and shifts). Taking n steps is the same as taking the 
+    polynomial x^n mod the characteristic polynomial, and then adding up 
+    (XOR) the states after 0, 1, 2... 255 steps wherever the result has a 1. 
+    x^n is found the same way as a^k for the LCG, by squaring. Each square is 
+    more work than a multiply, but it is still O(log2(n)).
+
+    The period is 2^256 - 1, so going back k steps is going forward 
+    2^256 - 1 - k steps. In 256 bits that is just NOT k. Like PCG32, the 
+    output comes from the state before the step, so skip n - 1. */
+    int64_t k = n - 1;
+    uint64_t exponent[4] = {(uint64_t)k, 0, 0, 0};
+    uint64_t poly[4] = {1, 0, 0, 0};
+
+    if(k < 0)
+    {
+        exponent[0] = ~(uint64_t)(-k);
+        exponent[1] = exponent[2] = exponent[3] = UINT64_MAX;
+    }
+
+    /* Left to right. Multiplying by x is just a shift. Squaring 1 is still 
+    1, so start at the highest bit that is set. */
+    int32_t bit = 255;
+    while(bit > 0 && !(exponent[bit / 64] & (1ULL << (bit % 64))))
+        bit--;
+
+    for(; bit >= 0; bit--)
+    {
+        Polynomial_Square(poly);
+        if(exponent[bit / 64] & (1ULL << (bit % 64)))
+            Polynomial_TimesX(poly);
+    }
+
+    Xoshiro256_Polynomial(state, poly);
+    return Xoshiro256_Next(state);
+}
+
+// *****************************************************************************
+
+void Xoshiro256_Jump(uint64_t *state)
+{
+    Xoshiro256_Polynomial(state, xoshiro256Jump);
+}
+
+// *****************************************************************************
+
+void Xoshiro256_LongJump(uint64_t *state)
+{
+    Xoshiro256_Polynomial(state, xoshiro256LongJump);
+}
+
+// *****************************************************************************
+
+uint64_t SplitMix64_Next(uint64_t *state)
+{
+    return SplitMix64_NextInline(state);
+}
+
+// *****************************************************************************
+
+uint64_t SplitMix64_Skip(uint64_t *state, int64_t n)
+{
+    /* The state is just a counter, so skipping is one multiply. The output 
+    comes from the state after the step. */
+    *state += (uint64_t)(n - 1) * SPLITMIX64_GAMMA;
+    return SplitMix64_Next(state);
+}
+
+// *****************************************************************************
+
+static void FillLCGBig(uint64_t *state, uint32_t *out, size_t n)
+{
+    uint64_t lane[PRNG_FILL_LANES];
+    uint64_t A, C, temp;
+    size_t i = 0;
+
+    /* Each lane steps forward PRNG_FILL_LANES numbers at a time, which is 
+    just another LCG with a different multiplier and increment. Instead of 
+    working out a^k and c(a^k - 1) / (a - 1) again, let the skip function do 
+    it. Skipping ahead from 0 leaves C in the state, and skipping ahead from 1 
+    leaves A + C. */
+    temp = 0;
+    LCGBig_Skip(&temp, PRNG_FILL_LANES);
+    C = temp;
+    temp = 1;
+    LCGBig_Skip(&temp, PRNG_FILL_LANES);
+    A = (temp - C) & LCG_BIG_MASK;
+
+    if(n >= 2 * PRNG_FILL_LANES)
+    {
+        /* The first number from each lane is just the next number in the 
+        sequence */
+        for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+        {
+            out[j] = LCGBig_Next(state);
+            lane[j] = *state;
+        }
+
+        /* The lanes don't depend on each other, so the compiler can run them 
+        side by side in vector registers */
+        for(i = PRNG_FILL_LANES; i + PRNG_FILL_LANES <= n; i += PRNG_FILL_LANES)
+        {
+            for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+            {
+                lane[j] = (A * lane[j] + C) & LCG_BIG_MASK;
+                out[i + j] = (uint32_t)(lane[j] >> 30ULL);
+            }
+        }
+        *state = lane[PRNG_FILL_LANES - 1];
+    }
+
+    for(; i < n; i++)
+        out[i] = LCGBig_Next(state);
+}
+
+// *****************************************************************************
+
+static void FillLCGSmall(uint32_t *state, uint32_t *out, size_t n)
+{
+    uint32_t lane[PRNG_FILL_LANES];
+    uint32_t A, C, temp;
+    size_t i = 0;
+
+    /* Same as the big LCG. Since m is 2^31, all the math can be done with 
+    32-bit variables and the upper bits thrown away. */
+    temp = 0;
+    LCGSmall_Skip(&temp, PRNG_FILL_LANES);
+    C = temp;
+    temp = 1;
+    LCGSmall_Skip(&temp, PRNG_FILL_LANES);
+    A = (temp - C) & LCG_SMALL_MASK;
+
+    if(n >= 2 * PRNG_FILL_LANES)
+    {
+        for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+        {
+            out[j] = LCGSmall_Next(state);
+            lane[j] = *state;
+        }
+
+        for(i = PRNG_FILL_LANES; i + PRNG_FILL_LANES <= n; i += PRNG_FILL_LANES)
+        {
+            for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+            {
+                lane[j] = (A * lane[j] + C) & LCG_SMALL_MASK;
+                out[i + j] = lane[j] >> 15;
+            }
+        }
+        *state = lane[PRNG_FILL_LANES - 1];
+    }
+
+    for(; i < n; i++)
+        out[i] = LCGSmall_Next(state);
+}
+
+// *****************************************************************************
+
+static void FillParkMiller(uint64_t *state, uint32_t *out, size_t n)
+{
+    uint32_t lane[PRNG_FILL_LANES];
+    uint64_t temp;
+    uint32_t A;
+    size_t i = 0;
+
+    /* There is no increment, so skipping ahead from 1 leaves a^k % m */
+    temp = 1;
+    ParkMiller_Skip(&temp, PRNG_FILL_LANES);
+    A = (uint32_t)temp;
+
+    if(n >= 2 * PRNG_FILL_LANES)
+    {
+        for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+            lane[j] = out[j] = ParkMiller_Next(state);
+
+        for(i = PRNG_FILL_LANES; i + PRNG_FILL_LANES <= n; i += PRNG_FILL_LANES)
+        {
+            for(uint32_t j = 0; j < PRNG_FILL_LANES; j++)
+            {
+                /* Both numbers are less than 2^31, so the product fits in 
+                62 bits. Because m is the Mersenne prime 2^31 - 1, the modulo 
+                can be done by adding the upper bits to the lower bits. 
+                (2^31 = 1 % m) Do it twice to fold the carry back in. The 
+                result can't be m, since that would mean the state is 0. */
+                uint64_t product = (uint64_t)A * lane[j];
+                uint32_t sum = (uint32_t)(product & PM_BIG_M) + (uint32_t)(product >> 31);
+                lane[j] = (sum & PM_BIG_M) + (sum >> 31);
+                out[i + j] = lane[j];
+            }
+        }
+        *state = lane[PRNG_FILL_LANES - 1];
+    }
+
+    for(; i < n; i++)
+        out[i] = ParkMiller_Next(state);
+}
+
+// *****************************************************************************
+
+static void Xoshiro256_Polynomial(uint64_t *state, const uint64_t *poly)
+{
+    uint64_t sum[4] = {0, 0, 0, 0};
+
+    /* Same as jump() in the reference code, but for any polynomial */
+    for(uint32_t i = 0; i < 4; i++)
+    {
+        for(uint32_t b = 0; b < 64; b++)
+        {
+            if(poly[i] & (1ULL << b))
+            {
+                sum[0] ^= state[0];
+                sum[1] ^= state[1];
+                sum[2] ^= state[2];
+                sum[3] ^= state[3];
+            }
+            Xoshiro256_Next(state);
+        }
+    }
+
+    state[0] = sum[0];
+    state[1] = sum[1];
+    state[2] = sum[2];
+    state[3] = sum[3];
+}
+
+// *****************************************************************************
+
+static void Polynomial_TimesX(uint64_t *poly)
+{
+    /* Shift up one. If x^256 falls off the top, replace it with the rest of 
+    the characteristic polynomial (they are equal, mod the polynomial) */
+    uint64_t carry = poly[3] >> 63;
+
+    poly[3] = (poly[3] << 1) | (poly[2] >> 63);
+    poly[2] = (poly[2] << 1) | (poly[1] >> 63);
+    poly[1] = (poly[1] << 1) | (poly[0] >> 63);
+    poly[0] = poly[0] << 1;
+
+    if(carry)
+    {
+        poly[0] ^= xoshiro256CharPoly[0];
+        poly[1] ^= xoshiro256CharPoly[1];
+        poly[2] ^= xoshiro256CharPoly[2];
+        poly[3] ^= xoshiro256CharPoly[3];
+    }
+}
+
+// *****************************************************************************
+
+static void Polynomial_Square(uint64_t *poly)
+{
+    /* Multiply by itself without carries, one bit at a time from the top, 
+    the same way as a bitwise CRC */
+    uint64_t result[4] = {0, 0, 0, 0};
+
+    for(int32_t bit = 255; bit >= 0; bit--)
+    {
+        Polynomial_TimesX(result);
+        if(poly[bit / 64] & (1ULL << (bit % 64)))
+        {
+            result[0] ^= poly[0];
+            result[1] ^= poly[1];
+            result[2] ^= poly[2];
+            result[3] ^= poly[3];
+        }
+    }
+
+    poly[0] = result[0];
+    poly[1] = result[1];
+    poly[2] = result[2];
+    poly[3] = result[3];
+}
+
+// *****************************************************************************
+
+static uint32_t Next32(PRNG *self)
+{
+    /* Lemire's method needs all 32 bits to be random. The small LCG and the 
+    Park Miller don't give that many in one number. See PRNG_Static.h. */
+    switch(self->type)
+    {
+        case PRNG_TYPE_LCG_SMALL:
+            return LCGSmall_Next32Inline(&(self->state.u32));
+        case PRNG_TYPE_PARK_MILLER:
+            return ParkMiller_Next32Inline(&(self->state.u64));
+        case PRNG_TYPE_SCHRAGE:
+            return Schrage_Next32Inline(&(self->state.u32));
+        default:
+            return PRNG_Next(self);
+    }
+}
+
+// *****************************************************************************
+
+static uint32_t Bounded(PRNG *self, uint32_t range)
+{
+    /* Daniel Lemire, "Fast Random Integer Generation in an Interval". 
+    Multiply a random 32-bit number by the range. The upper 32 bits of the 
+    product are the answer, between 0 and range - 1. A few answers come up 
+    one more time than the others. To fix that, throw away the products 
+    whose lower 32 bits are less than 2^32 % range. That threshold needs a 
+    division, but it can't be true unless the lower bits are less than the 
+    range. So the division is only done once in a great while. The old way 
+    had two divisions every time. On a Cortex-M0 with no hardware divide, 
+    each one is a slow library call.
+
+    A range of 0 means the whole 32 bits. */
+    if(range == 0)
+        return Next32(self);
+
+    uint64_t product = (uint64_t)Next32(self) * range;
+
+    if((uint32_t)product < range)
+    {
+        /* 2^32 % range, without needing a 64-bit divide */
+        uint32_t threshold = (0 - range) % range;
+
+        while((uint32_t)product < threshold)
+            product = (uint64_t)Next32(self) * range;
+    }
+    return (uint32_t)(product >> 32);
+}
+
+// *****************************************************************************
+
+static void FillLemire(PRNG *self, uint32_t *out, size_t n, uint32_t range, uint32_t lower,
+    bool countDown)
+{
+    /* Same as calling Bounded n times. If countDown is true, the range goes 
+    down by one for each number, which is what the shuffle needs. */
+    if(self->type == PRNG_TYPE_LCG_SMALL || self->type == PRNG_TYPE_PARK_MILLER ||
+        self->type == PRNG_TYPE_SCHRAGE)
+    {
+        /* These need more than one number for 32 random bits */
+        for(size_t i = 0; i < n; i++)
+            out[i] = Bounded(self, countDown ? range - i : range) + lower;
+        return;
+    }
+
+    /* Everything else gives 32 random bits per number, so PRNG_Fill can 
+    make them in bulk. Then they are turned into bounded numbers in place. 
+    When a number gets thrown away, everything after it slides down one spot, 
+    exactly like it would if Bounded was called n times. Read runs ahead of 
+    write, and when it runs out, fill in just enough for the spots that are 
+    left. Since every spot needs at least one number, this never takes more 
+    numbers from the PRNG than Bounded would. The range can't be 0 here. */
+    size_t write = 0;
+
+    while(write < n)
+    {
+        PRNG_Fill(self, out + write, n - write);
+
+        for(size_t read = write; read < n; read++)
+        {
+            uint32_t spotRange = countDown ? range - write : range;
+            uint64_t product = (uint64_t)out[read] * spotRange;
+
+            if((uint32_t)product < spotRange &&
+                (uint32_t)product < (0 - spotRange) % spotRange)
+                continue;
+
+            out[write++] = (uint32_t)(product >> 32) + lower;
+        }
+    }
+}
+
+// *****************************************************************************
+
+static void Fill64(PRNG *self, uint32_t *out, size_t n)
+{
+    uint64_t temp;
+
+    /* n 64-bit numbers, each one as the upper half and then the lower half. 
+    The 64-bit generators give all of their bits. Everything else takes two 
+    32-bit numbers, upper half first. */
+    switch(self->type)
+    {
+        case PRNG_TYPE_XOSHIRO256:
+            for(size_t i = 0; i < n; i++)
+            {
+                temp = Xoshiro256_Next(self->state.u64x4);
+                out[2 * i] = (uint32_t)(temp >> 32);
+                out[2 * i + 1] = (uint32_t)temp;
+            }
+            break;
+        case PRNG_TYPE_SPLITMIX64:
+            for(size_t i = 0; i < n; i++)
+            {
+                temp = SplitMix64_Next(&(self->state.u64));
+                out[2 * i] = (uint32_t)(temp >> 32);
+                out[2 * i + 1] = (uint32_t)temp;
+            }
+            break;
+        case PRNG_TYPE_LCG_BIG:
+        case PRNG_TYPE_PCG32:
+            /* Setting up the lanes costs a couple of skips, so only do it 
+            when there are enough numbers */
+            if(n >= PRNG_FILL_LANES)
+            {
+                PRNG_Fill(self, out, 2 * n);
+                break;
+            }
+            for(size_t i = 0; i < 2 * n; i++)
+                out[i] = PRNG_Next(self);
+            break;
+        default:
+            for(size_t i = 0; i < 2 * n; i++)
+                out[i] = Next32(self);
+            break;
+    }
+}
+
+// *****************************************************************************
+
+static uint64_t Draw64(PRNGDraws *draws)
+{
+    if(draws->next == draws->count)
+    {
+        /* Every number that is left to make needs at least one draw. Never 
+        make more than that, so the PRNG ends up in the same place as it would 
+        after calling PRNG_NextNormal that many times. */
+        draws->count = (draws->numLeft < FLOAT_BATCH_SIZE) ? draws->numLeft : FLOAT_BATCH_SIZE;
+        Fill64(draws->prng, draws->buffer, draws->count);
+        draws->next = 0;
+    }
+
+    uint64_t result = ((uint64_t)draws->buffer[2 * draws->next] << 32) |
+        draws->buffer[2 * draws->next + 1];
+    draws->next++;
+    return result;
+}
+
+// *****************************************************************************
+
+static double Normal(PRNGDraws *draws)
+{
+    /* Marsaglia and Tsang's ziggurat, with 256 layers and Doornik's fix. The
+    original used the same bits for the layer and for x. Here the lowest 8
+    bits pick the layer, the next one is the sign, and the top 53 bits are x.
+    No two of them overlap. The sign is a coin flip, so it is multiplied in
+    instead of picked with an if that would guess wrong half the time. About
+    99% of the time, x is inside the rectangle part of its layer, and that is
+    the answer. No log, exp, or sqrt. */
+    while(1)
+    {
+        uint64_t u = Draw64(draws);
+        uint32_t layer = u & (PRNG_ZIGGURAT_SIZE - 1);
+        double sign = 1.0 - 2.0 * (double)((u >> 8) & 1);
+        uint64_t j = u >> 11;
+        double x = j * zigguratW[layer];
+
+        if(j < zigguratK[layer])
+            return sign * x;
+
+        if(layer == 0)
+        {
+            /* The tail past R. Marsaglia's method, with two uniform numbers 
+            from 0 to 1, leaving out 0 so that log can't blow up. */
+            double y;
+
+            do {
+                x = -log(((Draw64(draws) >> 11) + 1) * DOUBLE_SCALE) * (1.0 / PRNG_ZIGGURAT_R);
+                y = -log(((Draw64(draws) >> 11) + 1) * DOUBLE_SCALE);
+            } while(y + y < x * x);
+
+            x += PRNG_ZIGGURAT_R;
+            return sign * x;
+        }
+
+        /* The sliver between the rectangle and the curve. Pick a height and 
+        see if it is under the curve. If not, start over. */
+        double height = zigguratF[layer] + ((Draw64(draws) >> 11) * DOUBLE_SCALE) *
+            (zigguratF[layer - 1] - zigguratF[layer]);
+
+        if(height < exp(-0.5 * x * x))
+            return sign * x;
+    }
+}
+
+// *****************************************************************************
+
+static inline void Swap(uint8_t *a, uint8_t *b, size_t s)
+{
+    uint8_t temp[SWAP_CHUNK_SIZE];
+
+    /* The common sizes get one load and one store each. memcpy with a 
+    constant size turns into a plain move. */
+    if(s == sizeof(uint32_t))
+    {
+        uint32_t x, y;
+        memcpy(&x, a, sizeof(x));
+        memcpy(&y, b, sizeof(y));
+        memcpy(a, &y, sizeof(y));
+        memcpy(b, &x, sizeof(x));
+    }
+    else if(s == sizeof(uint64_t))
+    {
+        uint64_t x, y;
+        memcpy(&x, a, sizeof(x));
+        memcpy(&y, b, sizeof(y));
+        memcpy(a, &y, sizeof(y));
+        memcpy(b, &x, sizeof(x));
+    }
+    else
+    {
+        /* A fixed size buffer, so a big element can't blow the stack */
+        for(size_t offset = 0; offset < s; offset += SWAP_CHUNK_SIZE)
+        {
+            size_t size = (s - offset < SWAP_CHUNK_SIZE) ? s - offset : SWAP_CHUNK_SIZE;
+            memcpy(temp, a + offset, size);
+            memcpy(a + offset, b + offset, size);
+            memcpy(b + offset, temp, size);
+        }
+    }
+}
+
+// *****************************************************************************
+
+static inline void Prefetch(const uint8_t *element, size_t s)
+{
+    /* Ask for every cache line of the element, not just the first one. 
+    Does nothing if the compiler doesn't have a way to do it. */
+#if defined(__GNUC__)
+    for(size_t offset = 0; offset < s; offset += CACHE_LINE_SIZE)
+        __builtin_prefetch(element + offset, 1);
+#else
+    (void)element;
+    (void)s;
+#endif
 }
 
 /*
@@ -6,6 +6,13 @@
  * @author Matthew Spinks <https://github.com/mspinksosu>
  * 
  * @date 9/23/23   Original creation
+ * @date 10/16/26  Added PRNG_Fill
+ * @date 10/16/26  Added PRNG_SplitStreams
+ * @date 10/16/26  Added PCG32, xoshiro256**, and SplitMix64
+ * @date 10/16/26  Bounded numbers use Lemire's method. Added PRNG_FillBounded
+ * @date 10/16/26  Faster shuffle. Added index shuffle and PRNG_Permute
+ * @date 10/16/26  Step functions moved to PRNG_Static.h for PRNG_DEFINE
+ * @date 10/16/26  Added floats, doubles, and normal numbers with a ziggurat
  * 
  * @details
  *      By far, the most attractive part of this library is the logarithmic 
@@ -41,6 +48,29 @@
  * a "full-cycle" LCG. Meaning it will produce every number from 1 to m-1 
  * once before the sequence repeats.
  * 
+ * The LCG's and the Park Miller are old and simple, but they have known 
+ * weaknesses. Their outputs fall on a lattice when you plot them in more than 
+ * a couple dimensions. I have added three newer generators that pass the 
+ * modern test suites and are faster on a 64-bit machine:
+ * 
+ * PCG32 is a 64-bit LCG with a power of two modulus, but instead of just 
+ * throwing away the weak lower bits, it scrambles the upper bits into the 
+ * output with a shift and a rotate. Since the state is an LCG, it has the 
+ * same logarithmic skip. Period 2^64.
+ * 
+ * xoshiro256** uses 256 bits of state that are mixed with XOR's, shifts, and 
+ * rotates, then scrambled with two multiplies. Period 2^256 - 1. It has jump 
+ * functions that move ahead 2^128 or 2^192 numbers, which is how you give 
+ * each thread its own piece of the sequence. It can also skip ahead any 
+ * number of steps, but that is slower than the LCG skip.
+ * 
+ * SplitMix64 is a counter that is run through a mixing function. It is the 
+ * fastest of the three and skipping is a single multiply. Period 2^64. It is 
+ * also used to seed xoshiro256**.
+ * 
+ * The 64-bit generators return the upper 32 bits through the PRNG object. 
+ * Call their functions directly if you want all 64 bits.
+ * 
  * // TODO more notes about Park Miller and Schrage
  * // TODO notes about PM value of 0 and X_0
  * // TODO lots of notes about the logarithmic skip ahead algorithm
@@ -50,6 +80,10 @@
  * PRNG class just makes it easier to manage multiple PRNG's and do things like 
  * give you a random number from a certain range.
  * 
+ * If you know which type you want ahead of time, PRNG_Static.h can make a 
+ * struct and functions for just that type with PRNG_DEFINE. There is no 
+ * switch, and the compiler can inline them. It gives the same numbers.
+ * 
  * @section license License
  * SPDX-FileCopyrightText: © 2023 Matthew Spinks
  * SPDX-License-Identifier: Zlib
@@ -65,9 +99,17 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 // ***** Defines ***************************************************************
 
+/* Number of copies of the PRNG that PRNG_Fill runs side by side. The output 
+is the same no matter what this is. More lanes keep more multiplies in flight, 
+but each one takes up to 8 bytes on the stack. On a small micro with not much 
+stack, you can make this smaller. */
+#ifndef PRNG_FILL_LANES
+#define PRNG_FILL_LANES     32
+#endif
 
 // ***** Global Variables ******************************************************
 
@@ -77,6 +119,9 @@ typedef enum PRNGTypeTag
     PRNG_TYPE_LCG_SMALL,
     PRNG_TYPE_PARK_MILLER,
     PRNG_TYPE_SCHRAGE,
+    PRNG_TYPE_PCG32,
+    PRNG_TYPE_XOSHIRO256,
+    PRNG_TYPE_SPLITMIX64,
     // TODO try making a bigger version of Park Miller
     // PRNG_TYPE_PARK_MILLER_BIG
 } PRNGType;
@@ -89,6 +134,7 @@ typedef struct PRNGTag
     {
         uint64_t u64;
         uint32_t u32;
+        uint64_t u64x4[4];
     } state;
 } PRNG;
 
@@ -106,7 +152,8 @@ typedef struct PRNGTag
  *        about it. Be aware that output will either be a 16-bit or a 32-bit 
  *        number, but my functions all return a 32-bit number for simplicity. 
  *        A 64-bit PRNG will return a 32-bit number, and a 32-bit PRNG will 
- *        return a 16-bit number.
+ *        return a 16-bit number. xoshiro256** uses all four words of 
+ *        u64x4.
  */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -125,7 +172,8 @@ typedef struct PRNGTag
  * @param self  pointer to the PRNG that you are using
  * 
  * @param type  PRNG_TYPE_LCG_BIG, PRNG_TYPE_LCG_SMALL, PRNG_TYPE_PARK_MILLER,
- *              PRNG_TYPE_SCHRAGE,
+ *              PRNG_TYPE_SCHRAGE, PRNG_TYPE_PCG32, PRNG_TYPE_XOSHIRO256, 
+ *              PRNG_TYPE_SPLITMIX64
  */
 void PRNG_Create(PRNG *self, PRNGType type);
 
@@ -148,9 +196,29 @@ void PRNG_Seed(PRNG *self, uint32_t seed);
  */
 uint32_t PRNG_Next(PRNG *self);
 
+/***************************************************************************//**
+ * @brief Fill an array with the next n numbers in the sequence
+ * 
+ * Gives the exact same numbers as calling PRNG_Next n times, and leaves the
+ * PRNG in the same state, but much faster. Several copies of the PRNG are
+ * skipped ahead so that they can be run side by side. Only worth it for
+ * bigger arrays. Short arrays just use the normal functions.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n uint32_t
+ * 
+ * @param n  number of values
+ */
+void PRNG_Fill(PRNG *self, uint32_t *out, size_t n);
+
 /***************************************************************************//**
  * @brief Return a random number within a specified boundary
  * 
+ * Every number in the range is equally likely. Uses Lemire's multiply and 
+ * shift method, which only needs a division once in a great while. The 
+ * small LCG and the Park Miller take two numbers per try.
+ * 
  * @param self  pointer to the PRNG that you are using
  * 
  * @param lower  lower bound inclusive
@@ -161,6 +229,113 @@ uint32_t PRNG_Next(PRNG *self);
  */
 uint32_t PRNG_NextBounded(PRNG *self, uint32_t lower, uint32_t upper);
 
+/***************************************************************************//**
+ * @brief Fill an array with random numbers within a specified boundary
+ * 
+ * Gives the exact same numbers as calling PRNG_NextBounded n times, and 
+ * leaves the PRNG in the same state. For the types that give 32 bits at a 
+ * time, the numbers are made with PRNG_Fill first, so it is much faster.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n uint32_t
+ * 
+ * @param n  number of values
+ * 
+ * @param lower  lower bound inclusive
+ * 
+ * @param upper  upper bound inclusive
+ */
+void PRNG_FillBounded(PRNG *self, uint32_t *out, size_t n, uint32_t lower, uint32_t upper);
+
+/***************************************************************************//**
+ * @brief Return a random float from 0 up to, but not including, 1
+ * 
+ * Uses 24 random bits, which is every bit a float has between 0.5 and 1. 
+ * Every answer is a multiple of 2^-24, and they are all equally likely. 
+ * There is no division.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @return float  0 <= output < 1
+ */
+float PRNG_NextFloat01(PRNG *self);
+
+/***************************************************************************//**
+ * @brief Return a random double from 0 up to, but not including, 1
+ * 
+ * Same as PRNG_NextFloat01, but with 53 random bits. xoshiro256** and 
+ * SplitMix64 only take one number. Everything else takes two.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @return double  0 <= output < 1
+ */
+double PRNG_NextDouble01(PRNG *self);
+
+/***************************************************************************//**
+ * @brief Return a random number from a normal (Gaussian) distribution
+ * 
+ * Uses the ziggurat method with tables that were worked out ahead of time. 
+ * Almost every time, it only takes one 64-bit random number, a multiply, and 
+ * a compare. Once in a while it needs exp or log.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param mean  the center of the bell curve
+ * 
+ * @param stdDev  the standard deviation
+ * 
+ * @return double  output
+ */
+double PRNG_NextNormal(PRNG *self, double mean, double stdDev);
+
+/***************************************************************************//**
+ * @brief Fill an array with random floats from 0 up to, but not including, 1
+ * 
+ * Gives the exact same numbers as calling PRNG_NextFloat01 n times, and 
+ * leaves the PRNG in the same state. Uses PRNG_Fill when it can.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n floats
+ * 
+ * @param n  number of values
+ */
+void PRNG_FillFloat01(PRNG *self, float *out, size_t n);
+
+/***************************************************************************//**
+ * @brief Fill an array with random doubles from 0 up to, but not including, 1
+ * 
+ * Gives the exact same numbers as calling PRNG_NextDouble01 n times, and 
+ * leaves the PRNG in the same state. Uses PRNG_Fill when it can.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n doubles
+ * 
+ * @param n  number of values
+ */
+void PRNG_FillDouble01(PRNG *self, double *out, size_t n);
+
+/***************************************************************************//**
+ * @brief Fill an array with random numbers from a normal distribution
+ * 
+ * Gives the exact same numbers as calling PRNG_NextNormal n times, and 
+ * leaves the PRNG in the same state. The random numbers are made in batches.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n doubles
+ * 
+ * @param n  number of values
+ * 
+ * @param mean  the center of the bell curve
+ * 
+ * @param stdDev  the standard deviation
+ */
+void PRNG_FillNormal(PRNG *self, double *out, size_t n, double mean, double stdDev);
+
 /***************************************************************************//**
  * @brief Perform logarithmic skip (forwards or backwards)
  * 
@@ -174,9 +349,37 @@ uint32_t PRNG_NextBounded(PRNG *self, uint32_t lower, uint32_t upper);
  */
 uint32_t PRNG_Skip(PRNG *self, int64_t n);
 
+/***************************************************************************//**
+ * @brief Split a PRNG into separate streams, one for each thread or task
+ * 
+ * Each stream is a copy of the parent that has been skipped ahead to the 
+ * start of its own block of the sequence. Stream 0 starts right where the 
+ * parent is, stream 1 starts blockLength numbers later, and so on. As long 
+ * as a stream doesn't use more than blockLength numbers, it won't overlap 
+ * the next one. If each stream uses exactly blockLength numbers, then all of 
+ * the streams back to back are the same numbers the parent would have given 
+ * you by itself. That means a job that is split up into blocks gives the 
+ * same answer no matter how many threads end up running the blocks. The 
+ * parent is not changed.
+ * 
+ * @param parent  pointer to the PRNG to split
+ * 
+ * @param k  number of streams
+ * 
+ * @param streams  pointer to an array of k PRNG's to set up
+ * 
+ * @param blockLength  numbers between the start of each stream. Use 0 to 
+ *                     divide the whole period of the PRNG evenly
+ */
+void PRNG_SplitStreams(PRNG *parent, uint32_t k, PRNG *streams, uint64_t blockLength);
+
 /***************************************************************************//**
  * @brief Shuffle an array using the Fisher-Yates method
  * 
+ * Uses its own PCG32 and PRNG_NextBounded's method to pick each index, so 
+ * every order is equally likely. Same as PRNG_ShuffleArray with a PCG32 
+ * seeded with seed.
+ * 
  * @param array  pointer to an array of any type
  * 
  * @param n  number of elements
@@ -187,6 +390,61 @@ uint32_t PRNG_Skip(PRNG *self, int64_t n);
  */
 void PRNG_Shuffle(void *array, uint32_t n, size_t s, uint32_t seed);
 
+/***************************************************************************//**
+ * @brief Shuffle an array using a PRNG that you provide
+ * 
+ * The random indexes are picked in batches, and the elements are asked for 
+ * a little ahead of time, which helps a lot once the array is bigger than 
+ * the cache. Elements of any size can be used. Big ones are swapped a piece 
+ * at a time, so nothing the size of an element goes on the stack.
+ * 
+ * If your elements are big, think about shuffling an array of indexes with 
+ * PRNG_ShuffleIndex instead. Then you can look the elements up through it 
+ * without moving them at all, or move them all later with PRNG_Permute.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param array  pointer to an array of any type
+ * 
+ * @param n  number of elements
+ * 
+ * @param s  the size in bytes of each element
+ */
+void PRNG_ShuffleArray(PRNG *self, void *array, uint32_t n, size_t s);
+
+/***************************************************************************//**
+ * @brief Fill an array with the numbers 0 to n - 1 in a random order
+ * 
+ * Uses the same random numbers as PRNG_ShuffleArray. So, with the same PRNG 
+ * state, PRNG_Permute with this index array puts an array in the same order 
+ * that PRNG_ShuffleArray would have.
+ * 
+ * @param self  pointer to the PRNG that you are using
+ * 
+ * @param index  pointer to an array of n uint32_t
+ * 
+ * @param n  number of elements
+ */
+void PRNG_ShuffleIndex(PRNG *self, uint32_t *index, uint32_t n);
+
+/***************************************************************************//**
+ * @brief Put an array in the order given by an index array
+ * 
+ * Element k ends up with what used to be at index[k]. It is done in place by 
+ * following the cycles of the permutation, so each element only has to be 
+ * brought in from memory once. The index array is changed while it works, 
+ * but it is put back at the end. n must be less than 2^31.
+ * 
+ * @param array  pointer to an array of any type
+ * 
+ * @param index  pointer to n indexes, each from 0 to n - 1 with no repeats
+ * 
+ * @param n  number of elements
+ * 
+ * @param s  the size in bytes of each element
+ */
+void PRNG_Permute(void *array, uint32_t *index, uint32_t n, size_t s);
+
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
 // ***** Individual PRNG Function Prototypes *********************************//
@@ -277,4 +535,91 @@ uint32_t ParkMiller_Skip(uint64_t *state, int64_t n);
  */
 uint32_t Schrage_Next(uint32_t *state);
 
+/***************************************************************************//**
+ * @brief PCG32 (PCG-XSH-RR with 64-bit state)
+ * 
+ * Range 0 to 2^32-1. Period 2^64. Uses the default increment from the 
+ * reference code.
+ * 
+ * @param state  pointer to the 64-bit state
+ * 
+ * @return uint32_t  output
+ */
+uint32_t PCG32_Next(uint64_t *state);
+
+/***************************************************************************//**
+ * @brief Logarithmic skip function for PCG32 (the "advance" function)
+ * 
+ * @param state  pointer to the 64-bit state
+ * 
+ * @param n  nth number. positive = forwards, negative = backwards
+ * 
+ * @return uint32_t  the nth number
+ */
+uint32_t PCG32_Skip(uint64_t *state, int64_t n);
+
+/***************************************************************************//**
+ * @brief xoshiro256**
+ * 
+ * Range 0 to 2^64-1. Period 2^256-1. The state must not be all zeros.
+ * 
+ * @param state  pointer to an array of four uint64_t
+ * 
+ * @return uint64_t  output
+ */
+uint64_t Xoshiro256_Next(uint64_t *state);
+
+/***************************************************************************//**
+ * @brief Skip function for xoshiro256**
+ * 
+ * Uses polynomial math over GF(2). Still O(log2(n)), but each step is much 
+ * more work than the LCG skip. Backwards takes about four times as long as 
+ * forwards.
+ * 
+ * @param state  pointer to an array of four uint64_t
+ * 
+ * @param n  nth number. positive = forwards, negative = backwards
+ * 
+ * @return uint64_t  the nth number
+ */
+uint64_t Xoshiro256_Skip(uint64_t *state, int64_t n);
+
+/***************************************************************************//**
+ * @brief Move xoshiro256** ahead 2^128 numbers
+ * 
+ * Call this once for every thread to give each one 2^128 numbers of its own.
+ * 
+ * @param state  pointer to an array of four uint64_t
+ */
+void Xoshiro256_Jump(uint64_t *state);
+
+/***************************************************************************//**
+ * @brief Move xoshiro256** ahead 2^192 numbers
+ * 
+ * @param state  pointer to an array of four uint64_t
+ */
+void Xoshiro256_LongJump(uint64_t *state);
+
+/***************************************************************************//**
+ * @brief SplitMix64
+ * 
+ * Range 0 to 2^64-1. Period 2^64.
+ * 
+ * @param state  pointer to the 64-bit state
+ * 
+ * @return uint64_t  output
+ */
+uint64_t SplitMix64_Next(uint64_t *state);
+
+/***************************************************************************//**
+ * @brief Skip function for SplitMix64
+ * 
+ * @param state  pointer to the 64-bit state
+ * 
+ * @param n  nth number. positive = forwards, negative = backwards
+ * 
+ * @return uint64_t  the nth number
+ */
+uint64_t SplitMix64_Skip(uint64_t *state, int64_t n);
+
 #endif  /* PRNG_H */
\ No newline at end of file
@@ -0,0 +1,286 @@
+/***************************************************************************//**
+ * @brief Multi-Threaded Shuffle for Large Arrays
+ * 
+ * @file PRNG_Parallel.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See PRNG_Parallel.h. The work is done one level at a time. First
+ * every block is shuffled, then pairs of blocks are merged, then pairs of
+ * those, and so on until there is one block left. Each level is a list of
+ * tasks, and the threads take the next task off the list until it is empty.
+ * A level has to finish before the next one starts, so the threads are
+ * joined after each level. There are only log2(blocks) + 1 levels.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "PRNG_Parallel.h"
+#include <string.h>
+#include <pthread.h>
+
+// ***** Defines ***************************************************************
+
+/* Elements bigger than this are swapped a piece at a time */
+#define SWAP_CHUNK_SIZE     64
+
+// ***** Global Variables ******************************************************
+
+typedef struct PRNGParallelTaskTag
+{
+    PRNG prng;
+    uint32_t start;
+    uint32_t middle;
+    uint32_t end;
+} PRNGParallelTask;
+
+typedef struct PRNGParallelLevelTag
+{
+    uint8_t *array;
+    size_t s;
+    bool merge;
+    PRNGParallelTask *tasks;
+    uint32_t numTasks;
+    uint32_t nextTask;
+    pthread_mutex_t lock;
+} PRNGParallelLevel;
+
+// ***** Static Function Prototypes ********************************************
+
+static void RunLevel(PRNGParallelLevel *level, uint32_t numThreads);
+static void *Work(void *arg);
+static void Merge(PRNG *prng, uint8_t *array, size_t s, uint32_t middle, uint32_t n);
+static inline void Swap(uint8_t *a, uint8_t *b, size_t s);
+
+// *****************************************************************************
+
+void PRNG_Parallel_Shuffle(void *array, uint32_t n, size_t s, uint32_t seed, uint32_t numThreads)
+{
+    PRNG streams[2 * PRNG_PARALLEL_MAX_BLOCKS];
+    PRNGParallelTask tasks[PRNG_PARALLEL_MAX_BLOCKS];
+    PRNGParallelLevel level;
+    PRNG parent;
+    uint32_t numBlocks = 1;
+    uint32_t nextStream = 0;
+
+    if(numThreads > PRNG_PARALLEL_MAX_THREADS)
+        numThreads = PRNG_PARALLEL_MAX_THREADS;
+
+    if(numThreads == 0)
+        numThreads = 1;
+
+    /* The number of blocks can't depend on the number of threads, or the
+    answer would change with it */
+    while(numBlocks < PRNG_PARALLEL_MAX_BLOCKS && n / (numBlocks * 2) >= PRNG_PARALLEL_MIN_BLOCK)
+        numBlocks *= 2;
+
+    /* One stream for each block, and one for each merge */
+    PRNG_Create(&parent, PRNG_TYPE_XOSHIRO256);
+    PRNG_Seed(&parent, seed);
+    PRNG_SplitStreams(&parent, 2 * numBlocks - 1, streams, 0);
+
+    level.array = array;
+    level.s = s;
+    pthread_mutex_init(&level.lock, NULL);
+
+    /* Shuffle every block by itself */
+    for(uint32_t b = 0; b < numBlocks; b++)
+    {
+        tasks[b].prng = streams[nextStream++];
+        tasks[b].start = (uint64_t)n * b / numBlocks;
+        tasks[b].end = (uint64_t)n * (b + 1) / numBlocks;
+    }
+    level.merge = false;
+    level.tasks = tasks;
+    level.numTasks = numBlocks;
+    RunLevel(&level, numThreads);
+
+    /* Then merge them, two at a time */
+    for(uint32_t width = 1; width < numBlocks; width *= 2)
+    {
+        uint32_t numTasks = 0;
+
+        for(uint32_t b = 0; b < numBlocks; b += 2 * width)
+        {
+            tasks[numTasks].prng = streams[nextStream++];
+            tasks[numTasks].start = (uint64_t)n * b / numBlocks;
+            tasks[numTasks].middle = (uint64_t)n * (b + width) / numBlocks;
+            tasks[numTasks].end = (uint64_t)n * (b + 2 * width) / numBlocks;
+            numTasks++;
+        }
+        level.merge = true;
+        level.numTasks = numTasks;
+        RunLevel(&level, numThreads);
+    }
+
+    pthread_mutex_destroy(&level.lock);
+}
+
+// *****************************************************************************
+
+static void RunLevel(PRNGParallelLevel *level, uint32_t numThreads)
+{
+    pthread_t threads[PRNG_PARALLEL_MAX_THREADS];
+    bool started[PRNG_PARALLEL_MAX_THREADS];
+
+    if(numThreads > level->numTasks)
+        numThreads = level->numTasks;
+
+    level->nextTask = 0;
+
+    /* The calling thread works too. If a thread can't be started, the ones
+    that did start just take more of the tasks. */
+    for(uint32_t i = 1; i < numThreads; i++)
+        started[i] = (pthread_create(&threads[i], NULL, Work, level) == 0);
+
+    Work(level);
+
+    for(uint32_t i = 1; i < numThreads; i++)
+    {
+        if(started[i])
+            pthread_join(threads[i], NULL);
+    }
+}
+
+// *****************************************************************************
+
+static void *Work(void *arg)
+{
+    PRNGParallelLevel *level = arg;
+
+    while(1)
+    {
+        pthread_mutex_lock(&level->lock);
+        uint32_t t = level->nextTask++;
+        pthread_mutex_unlock(&level->lock);
+
+        if(t >= level->numTasks)
+            break;
+
+        PRNGParallelTask *task = &level->tasks[t];
+        uint8_t *start = level->array + (size_t)task->start * level->s;
+
+        if(level->merge)
+            Merge(&task->prng, start, level->s, task->middle - task->start, task->end - task->start);
+        else
+            PRNG_ShuffleArray(&task->prng, start, task->end - task->start, level->s);
+    }
+    return NULL;
+}
+
+// *****************************************************************************
+
+static void Merge(PRNG *prng, uint8_t *array, size_t s, uint32_t middle, uint32_t n)
+{
+    uint32_t u = 0, v = middle;
+    uint32_t bits = 0, numBits = 0;
+
+    /* Both halves are already shuffled. Flip a coin for every spot. Heads,
+    the next element from the right side is swapped into this spot. Tails,
+    whatever is here stays. Stop when either side runs out.
+
+    A coin flip can't be predicted, so an if on it costs a pipeline flush
+    half the time. For 4 byte elements, while neither side is close to
+    running out, pick with a mask instead of an if. */
+    if(s == sizeof(uint32_t))
+    {
+        while(v < n && u < v)
+        {
+            uint32_t x, y;
+
+            if(numBits == 0)
+            {
+                bits = PRNG_Next(prng);
+                numBits = 32;
+            }
+
+            uint32_t heads = bits & 1;
+            uint32_t mask = 0 - heads;
+            bits >>= 1;
+            numBits--;
+
+            memcpy(&x, array + (size_t)u * 4, 4);
+            memcpy(&y, array + (size_t)v * 4, 4);
+            uint32_t swapped = (x ^ y) & mask;
+            x ^= swapped;
+            y ^= swapped;
+            memcpy(array + (size_t)u * 4, &x, 4);
+            memcpy(array + (size_t)v * 4, &y, 4);
+            v += heads;
+            u++;
+        }
+    }
+
+    while(1)
+    {
+        if(numBits == 0)
+        {
+            bits = PRNG_Next(prng);
+            numBits = 32;
+        }
+
+        bool heads = bits & 1;
+        bits >>= 1;
+        numBits--;
+
+        if(heads)
+        {
+            if(v == n)
+                break;
+            Swap(array + (size_t)u * s, array + (size_t)v * s, s);
+            v++;
+        }
+        else if(u == v)
+        {
+            break;
+        }
+        u++;
+    }
+
+    /* The rest of the elements are mixed in the same way as Fisher-Yates,
+    each one with a random spot that comes before it */
+    for(; u < n; u++)
+    {
+        uint32_t i = PRNG_NextBounded(prng, 0, u);
+        Swap(array + (size_t)i * s, array + (size_t)u * s, s);
+    }
+}
+
+// *****************************************************************************
+
+static inline void Swap(uint8_t *a, uint8_t *b, size_t s)
+{
+    uint8_t temp[SWAP_CHUNK_SIZE];
+
+    if(s == sizeof(uint32_t))
+    {
+        uint32_t x, y;
+        memcpy(&x, a, sizeof(x));
+        memcpy(&y, b, sizeof(y));
+        memcpy(a, &y, sizeof(y));
+        memcpy(b, &x, sizeof(x));
+        return;
+    }
+
+    for(size_t offset = 0; offset < s; offset += SWAP_CHUNK_SIZE)
+    {
+        size_t size = (s - offset < SWAP_CHUNK_SIZE) ? s - offset : SWAP_CHUNK_SIZE;
+        memcpy(temp, a + offset, size);
+        memcpy(a + offset, b + offset, size);
+        memcpy(b + offset, temp, size);
+    }
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,86 @@
+/***************************************************************************//**
+ * @brief Multi-Threaded Shuffle for Large Arrays Header
+ * 
+ * @file PRNG_Parallel.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      Fisher-Yates can't be split up between threads, since every swap can 
+ * touch any part of the array. For tens of millions of elements, this uses 
+ * MergeShuffle instead, from Bacher, Bodini, Hollender, and Lumbroso, 
+ * "MergeShuffle: A Very Fast, Parallel Random Permutation Algorithm". The 
+ * array is cut into blocks and each block is shuffled on its own. Then 
+ * neighboring blocks are merged two at a time by flipping a coin to pick 
+ * which side the next element comes from, until one side runs out. The 
+ * leftovers are mixed in with a few more Fisher-Yates steps. Merges on the 
+ * same level don't overlap, so they run at the same time too. Every order 
+ * is still equally likely.
+ * 
+ * The number of blocks only depends on n, and each block and merge gets its 
+ * own xoshiro256** stream (2^128 numbers apart) from the seed. So for the 
+ * same seed you get the same order no matter how many threads you use. It 
+ * is not the same order that PRNG_Shuffle would give you.
+ * 
+ * This is meant for host machines. It uses POSIX threads, so link with 
+ * -pthread. The threads are started and joined inside the function.
+ * 
+ * @section example_code Example Code
+ * 
+ *      PRNG_Parallel_Shuffle(records, numRecords, sizeof(records[0]), seed, 8);
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef PRNG_PARALLEL_H
+#define PRNG_PARALLEL_H
+
+#include "PRNG.h"
+
+// ***** Defines ***************************************************************
+
+#define PRNG_PARALLEL_MAX_THREADS   64
+
+/* The most blocks the array is cut into. Must be a power of two. */
+#define PRNG_PARALLEL_MAX_BLOCKS    64
+
+/* Each block gets at least this many elements. Below that, starting a 
+thread takes longer than just doing the work. */
+#ifndef PRNG_PARALLEL_MIN_BLOCK
+#define PRNG_PARALLEL_MIN_BLOCK     (64UL * 1024UL)
+#endif
+
+// ***** Global Variables ******************************************************
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Shuffle a big array using more than one thread
+ * 
+ * @param array  pointer to an array of any type
+ * 
+ * @param n  number of elements
+ * 
+ * @param s  the size in bytes of each element
+ * 
+ * @param seed  seed for the shuffle
+ * 
+ * @param numThreads  how many threads to use, including the one calling this
+ */
+void PRNG_Parallel_Shuffle(void *array, uint32_t n, size_t s, uint32_t seed, uint32_t numThreads);
+
+#endif  /* PRNG_PARALLEL_H */
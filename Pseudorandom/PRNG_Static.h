@@ -0,0 +1,446 @@
+/***************************************************************************//**
+ * @brief Pseudorandom Number Generators Picked at Compile Time
+ * 
+ * @file PRNG_Static.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * @date 10/16/26  Schrage step no longer overflows a signed int
+ * 
+ * @details
+ *      The PRNG object in PRNG.h can be any type, which is handy, but it
+ * means every call goes through a switch on the type and a check to see if
+ * it has been seeded. For a generator that is only a multiply and an add,
+ * that is a lot of the work. The functions are also in PRNG.c, so the
+ * compiler can't inline them into your loop.
+ * 
+ * If you already know what type you want when you write the code, use
+ * PRNG_DEFINE instead. It makes a struct that only holds the state for that
+ * one type, and static inline functions to go with it:
+ * 
+ * PRNG_DEFINE(DiceRNG, PRNG_TYPE_PCG32)
+ * 
+ * DiceRNG dice;
+ * DiceRNG_Seed(&dice, 1234);
+ * uint32_t roll = DiceRNG_NextBounded(&dice, 1, 6);
+ * 
+ * The functions it makes are name_Seed, name_Next, name_Next32,
+ * name_NextBounded, and name_Skip. They give the exact same numbers as the
+ * PRNG object of the same type with the same seed. There is no isSeeded
+ * check, so call name_Seed before you use it. The type has to be written out
+ * as one of the PRNG_TYPE names, because it gets pasted onto the end of a
+ * macro name. A variable won't work.
+ * 
+ * The step functions for each type are in this file too, so the ones in
+ * PRNG.c and the ones made here are the same code. Skipping is still done by
+ * the functions in PRNG.c. It is a loop, so there isn't much to gain by
+ * inlining it. It just doesn't go through the switch.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef PRNG_STATIC_H
+#define PRNG_STATIC_H
+
+#include "PRNG.h"
+
+// ***** Defines ***************************************************************
+
+/* Using this LCG requires 64-bit math. Modulus m is power of two */
+#define LCG_BIG_M               (1ULL << 63)
+#define LCG_BIG_MASK            (LCG_BIG_M - 1ULL)
+#define LCG_BIG_A               3249286849523012805ULL
+/* m and c must be relatively prime, so c = 1 is commonly chosen */
+#define LCG_BIG_C               1ULL
+#define LCG_BIG_DEFAULT_SEED    1ULL
+
+/* Modulus m is power of two */
+#define LCG_SMALL_M             (1UL << 31)
+#define LCG_SMALL_MASK          (LCG_SMALL_M - 1UL)
+#define LCG_SMALL_A             20501397UL
+/* m and c must be relatively prime, so c = 1 is commonly chosen */
+#define LCG_SMALL_C             1UL
+#define LCG_SMALL_DEFAULT_SEED  1UL
+
+/* Prime numbers that are closer to the maximum value for a given bit size tend
+to work better. The 8th Mersenne prime is often chosen for m because it is very
+close to 2^32. It is also the default value for C++ minstd_rand */
+#define PM_BIG_M                ((1UL << 31) - 1UL)
+#define PM_BIG_A                48271UL
+
+/* For a mulplicative LCG like the Park Miller, the initial value X_0 must be
+relatively prime to m. If m is chosen to be a prime number, then any value
+from 0 < X_0 < m will work. */
+#define PM_DEFAULT_SEED         1UL
+
+/* Precomputed values for Schrage's method. I will use the same multiplier and
+modulus as the 32-bit Park Miller */
+#define SCH_M                   ((1UL << 31) - 1UL)
+#define SCH_A                   48271UL
+#define SCH_Q                   44488 // Q = M / A
+#define SCH_R                   3399  // R = M % A
+
+/* PCG32 is a 64-bit LCG with a power of two modulus (2^64, so the modulus is
+free) that scrambles its output. These are the multiplier and increment from
+O'Neill's reference code. */
+#define PCG32_A                 6364136223846793005ULL
+#define PCG32_C                 1442695040888963407ULL
+#define PCG32_DEFAULT_SEED      1ULL
+
+/* SplitMix64 just adds the golden ratio to its state and mixes the result */
+#define SPLITMIX64_GAMMA        0x9E3779B97F4A7C15ULL
+#define SPLITMIX64_DEFAULT_SEED 1ULL
+
+/* xoshiro256** is seeded with SplitMix64, like the authors recommend */
+#define XOSHIRO256_DEFAULT_SEED 1ULL
+
+/* The Park Miller gives 1 to m - 1. Groups of 2^16 that fit under that. */
+#define PM_16_BIT_LIMIT         (PM_BIG_M - 1 - ((PM_BIG_M - 1) & 0xFFFF))
+
+/***************************************************************************//**
+ * @brief Make a PRNG struct and functions for one type
+ * 
+ * @param name  the name of the new struct. Also the start of each function
+ * 
+ * @param type  PRNG_TYPE_LCG_BIG, PRNG_TYPE_LCG_SMALL, PRNG_TYPE_PARK_MILLER,
+ *              PRNG_TYPE_SCHRAGE, PRNG_TYPE_PCG32, PRNG_TYPE_XOSHIRO256,
+ *              PRNG_TYPE_SPLITMIX64
+ */
+#define PRNG_DEFINE(name, type)     PRNG_DEFINE_##type(name)
+
+#define PRNG_DEFINE_PRNG_TYPE_LCG_BIG(name) \
+    PRNG_DEFINE_TYPE(name, uint64_t state, &self->state, LCG_BIG_DEFAULT_SEED, \
+        PRNG_SeedPlain64Inline, LCGBig_NextInline, LCGBig_NextInline, 0, LCGBig_Skip)
+
+#define PRNG_DEFINE_PRNG_TYPE_LCG_SMALL(name) \
+    PRNG_DEFINE_TYPE(name, uint32_t state, &self->state, LCG_SMALL_DEFAULT_SEED, \
+        PRNG_SeedPlain32Inline, LCGSmall_NextInline, LCGSmall_Next32Inline, 0, LCGSmall_Skip)
+
+#define PRNG_DEFINE_PRNG_TYPE_PARK_MILLER(name) \
+    PRNG_DEFINE_TYPE(name, uint64_t state, &self->state, PM_DEFAULT_SEED, \
+        PRNG_SeedPlain64Inline, ParkMiller_NextInline, ParkMiller_Next32Inline, 0, \
+        ParkMiller_Skip)
+
+#define PRNG_DEFINE_PRNG_TYPE_SCHRAGE(name) \
+    PRNG_DEFINE_TYPE(name, uint32_t state, &self->state, PM_DEFAULT_SEED, \
+        PRNG_SeedPlain32Inline, Schrage_NextInline, Schrage_Next32Inline, 0, \
+        Schrage_SkipInline)
+
+#define PRNG_DEFINE_PRNG_TYPE_PCG32(name) \
+    PRNG_DEFINE_TYPE(name, uint64_t state, &self->state, PCG32_DEFAULT_SEED, \
+        PCG32_SeedInline, PCG32_NextInline, PCG32_NextInline, 0, PCG32_Skip)
+
+#define PRNG_DEFINE_PRNG_TYPE_XOSHIRO256(name) \
+    PRNG_DEFINE_TYPE(name, uint64_t state[4], self->state, XOSHIRO256_DEFAULT_SEED, \
+        Xoshiro256_SeedInline, Xoshiro256_NextInline, Xoshiro256_NextInline, 32, \
+        Xoshiro256_Skip)
+
+#define PRNG_DEFINE_PRNG_TYPE_SPLITMIX64(name) \
+    PRNG_DEFINE_TYPE(name, uint64_t state, &self->state, SPLITMIX64_DEFAULT_SEED, \
+        PRNG_SeedPlain64Inline, SplitMix64_NextInline, SplitMix64_NextInline, 32, \
+        SplitMix64_Skip)
+
+/* The part that is the same for every type. member is how the state is
+declared in the struct, and stateRef is how to pass it to the step function.
+The 64-bit generators give their upper 32 bits, the same as PRNG_Next. */
+#define PRNG_DEFINE_TYPE(name, member, stateRef, defaultSeed, SeedFunc, NextFunc, \
+    Next32Func, shift, SkipFunc) \
+\
+typedef struct name##Tag \
+{ \
+    member; \
+} name; \
+\
+static inline void name##_Seed(name *self, uint32_t seed) \
+{ \
+    if(seed == 0) \
+        seed = (uint32_t)(defaultSeed); \
+    SeedFunc(stateRef, seed); \
+} \
+\
+static inline uint32_t name##_Next(name *self) \
+{ \
+    return (uint32_t)(NextFunc(stateRef) >> (shift)); \
+} \
+\
+static inline uint32_t name##_Next32(name *self) \
+{ \
+    return (uint32_t)(Next32Func(stateRef) >> (shift)); \
+} \
+\
+static inline uint32_t name##_NextBounded(name *self, uint32_t lower, uint32_t upper) \
+{ \
+    if(lower > upper) \
+    { \
+        uint32_t temp = lower; \
+        lower = upper; \
+        upper = temp; \
+    } \
+    uint32_t range = upper - lower + 1; \
+    if(range == 0) \
+        return name##_Next32(self); \
+    uint64_t product = (uint64_t)name##_Next32(self) * range; \
+    if((uint32_t)product < range) \
+    { \
+        uint32_t threshold = (0 - range) % range; \
+        while((uint32_t)product < threshold) \
+            product = (uint64_t)name##_Next32(self) * range; \
+    } \
+    return (uint32_t)(product >> 32) + lower; \
+} \
+\
+static inline uint32_t name##_Skip(name *self, int64_t n) \
+{ \
+    return (uint32_t)(SkipFunc(stateRef, n) >> (shift)); \
+}
+
+// ***** Global Variables ******************************************************
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Inline Step Functions ***********************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static inline uint64_t PRNG_RotateLeft64Inline(uint64_t x, uint32_t k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// *****************************************************************************
+
+static inline void PRNG_SeedPlain64Inline(uint64_t *state, uint32_t seed)
+{
+    *state = seed;
+}
+
+// *****************************************************************************
+
+static inline void PRNG_SeedPlain32Inline(uint32_t *state, uint32_t seed)
+{
+    *state = seed;
+}
+
+// *****************************************************************************
+
+static inline uint32_t LCGBig_NextInline(uint64_t *state)
+{
+    /* This version will use a power of two for the modulus for speed with
+    the lower bits removed. Similar to C rand, but with 32-bit result.
+    Multiplier a will be chosen from L'Ecuyer research paper. Increment c
+    will need to be odd. Try with c = 1. */
+
+    /* TODO Possible output values should be in the range 0 to 2^32-1. But
+    output is not full-cycle. Need to verify. */
+
+    /* X_n+1 = (a * X_n + c) % m */
+    *state = (LCG_BIG_A * (*state) + LCG_BIG_C) & LCG_BIG_MASK;
+    return (uint32_t)(*state >> 30ULL); // bits[62:31]
+}
+
+// *****************************************************************************
+
+static inline uint16_t LCGSmall_NextInline(uint32_t *state)
+{
+    /* This version is similar to C rand. I will use a power of two for
+    the modulus for speed with the lower bits removed. Multiplier a will be
+    chosen from L'Ecuyer research paper. Increment c needs to be odd. I will
+    use c = 1. */
+
+    /* TODO Possible output values should be in the range 0 to 2^16-1. But
+    output is not full-cycle. Need to verify. */
+
+    /* X_n+1 = (a * X_n + c) % m */
+    *state = (LCG_SMALL_A * (*state) + LCG_SMALL_C) & LCG_SMALL_MASK;
+    return (uint16_t)(*state >> 15ULL); // bits[30:15]
+}
+
+// *****************************************************************************
+
+static inline uint32_t LCGSmall_Next32Inline(uint32_t *state)
+{
+    /* Lemire's method needs all 32 bits to be random. The small LCG only
+    gives 16 bits at a time, so use two of them. */
+    uint32_t high = LCGSmall_NextInline(state);
+    uint32_t low = LCGSmall_NextInline(state);
+    return (high << 16) | low;
+}
+
+// *****************************************************************************
+
+static inline uint32_t ParkMiller_NextInline(uint64_t *state)
+{
+    /* TODO Add more notes
+    This version will be a full-cycle PRNG with a modulus of a prime
+    number and c = 0. I believe the output values should be in the range of
+    1 to m - 1. */
+
+    /* X_n+1 = (a * X_n) % m */
+    *state = (PM_BIG_A * (*state)) % PM_BIG_M;
+    return *state;
+}
+
+// *****************************************************************************
+
+static inline uint32_t ParkMiller_Next32Inline(uint64_t *state)
+{
+    /* The Park Miller gives 1 to m - 1, which isn't a power of two. Take the
+    lower 16 bits of (output - 1), but throw it away if it's in the last
+    partial group of 2^16 at the top. That only happens about once every
+    32768 numbers. */
+    uint32_t high, low;
+
+    do {
+        high = ParkMiller_NextInline(state) - 1;
+    } while(high >= PM_16_BIT_LIMIT);
+    do {
+        low = ParkMiller_NextInline(state) - 1;
+    } while(low >= PM_16_BIT_LIMIT);
+    return (high << 16) | (low & 0xFFFF);
+}
+
+// *****************************************************************************
+
+static inline uint32_t Schrage_NextInline(uint32_t *state)
+{
+    int32_t result;
+    uint32_t X = *state;
+    uint32_t X_Div_Q, X_Mod_Q;
+    /* Schrage's method is a version of a Park Miller that avoids the need to
+    use a 64-bit variable to store the product of a * x. For any integer "m"
+    and "a > 0" there exists unique integers "q" (quotient) and "r" (remainder)
+    such that "m = a * q + r" and "0 <= r < m".
+
+    "q = m / a" (integer division) and "r = m % a". We compute the product
+    a * x by the approximation: a * x = a(x % q) - r[x / q] (integer division).
+    Then take the result and perform % m to it. This modulo m is further
+    simplified: if a * x = a(x % q) - r[x / q] is negative, m is added to it. */
+
+    /* ax % m = a(x % q) - r[x / q] % m
+    For X_Mod_Q, since we already have x / q, x % q can easily be done without
+    doing any actual modulo division. The seed can be more than m, so x / q
+    and x % q are unsigned. Both products still fit in an int32_t. */
+    X_Div_Q = X / SCH_Q;
+    X_Mod_Q = X - X_Div_Q * SCH_Q;
+    result = (int32_t)(SCH_A * X_Mod_Q) - (int32_t)(SCH_R * X_Div_Q);
+    if(result < 0)
+        result += SCH_M;
+
+    return *state = (uint32_t)result;
+}
+
+// *****************************************************************************
+
+static inline uint32_t Schrage_Next32Inline(uint32_t *state)
+{
+    /* Same as the Park Miller */
+    uint32_t high, low;
+
+    do {
+        high = Schrage_NextInline(state) - 1;
+    } while(high >= PM_16_BIT_LIMIT);
+    do {
+        low = Schrage_NextInline(state) - 1;
+    } while(low >= PM_16_BIT_LIMIT);
+    return (high << 16) | (low & 0xFFFF);
+}
+
+// *****************************************************************************
+
+static inline uint32_t Schrage_SkipInline(uint32_t *state, int64_t n)
+{
+    /* The Schrage uses the same multiplier and modulus as the Park Miller, so
+    the Park Miller skip works. It just needs a 64-bit state. */
+    uint64_t temp = *state;
+    uint32_t result = ParkMiller_Skip(&temp, n);
+    *state = (uint32_t)temp;
+    return result;
+}
+
+// *****************************************************************************
+
+static inline uint32_t PCG32_NextInline(uint64_t *state)
+{
+    /* Melissa O'Neill, "PCG: A Family of Simple Fast Space-Efficient
+    Statistically Good Algorithms for Random Number Generation". The state is
+    a plain 64-bit LCG, which is weak in the lower bits just like my LCG's.
+    But instead of throwing the lower bits away, the output is an xorshift of
+    the old state (upper bits into the lower bits), then a rotate by an amount
+    chosen by the top five bits. This is PCG-XSH-RR. */
+    uint64_t old = *state;
+    *state = old * PCG32_A + PCG32_C;
+
+    uint32_t xorShifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rotate = (uint32_t)(old >> 59);
+    return (xorShifted >> rotate) | (xorShifted << ((32 - rotate) & 31));
+}
+
+// *****************************************************************************
+
+static inline void PCG32_SeedInline(uint64_t *state, uint32_t seed)
+{
+    /* Same as pcg32_srandom_r from the reference code. Step once from 0 so
+    the increment gets mixed in, add the seed, then step again. */
+    *state = 0;
+    PCG32_NextInline(state);
+    *state += seed;
+    PCG32_NextInline(state);
+}
+
+// *****************************************************************************
+
+static inline uint64_t Xoshiro256_NextInline(uint64_t *state)
+{
+    /* Blackman and Vigna, "Scrambled Linear Pseudorandom Number Generators".
+    The state is four 64-bit words that get shifted and XOR'd into each other.
+    The ** scrambler (multiply, rotate, multiply) hides the weak lower bits of
+    the linear engine. */
+    uint64_t result = PRNG_RotateLeft64Inline(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = PRNG_RotateLeft64Inline(state[3], 45);
+
+    return result;
+}
+
+// *****************************************************************************
+
+static inline uint64_t SplitMix64_NextInline(uint64_t *state)
+{
+    /* From Steele, Lea, and Flood, "Fast Splittable Pseudorandom Number
+    Generators". The state is a counter that goes up by an odd number (based
+    on the golden ratio). The output is the counter run through a 64-bit
+    mixing function. Very fast, and the usual way to seed other generators. */
+    uint64_t z = (*state += SPLITMIX64_GAMMA);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// *****************************************************************************
+
+static inline void Xoshiro256_SeedInline(uint64_t *state, uint32_t seed)
+{
+    /* The state can't be all zeros. SplitMix64 never gives four zeros in a
+    row. */
+    uint64_t splitMixState = seed;
+
+    for(uint32_t i = 0; i < 4; i++)
+        state[i] = SplitMix64_NextInline(&splitMixState);
+}
+
+#endif  /* PRNG_STATIC_H */
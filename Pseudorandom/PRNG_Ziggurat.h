@@ -0,0 +1,249 @@
+/***************************************************************************//**
+ * @brief Ziggurat Tables for the Normal Distribution
+ * 
+ * @file PRNG_Ziggurat.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      These are the tables for PRNG_NextNormal in PRNG.c. The right half of 
+ * the bell curve is cut into 256 layers that all have the same area. Each 
+ * layer is a rectangle, except for the bottom one, which also has the tail 
+ * past R. Picking a layer at random and then a random spot across it almost 
+ * always lands under the curve, which only costs a multiply and a compare. 
+ * 
+ * The tables were made ahead of time with the zigset() setup from Marsaglia 
+ * and Tsang, "The Ziggurat Method for Generating Random Variables", changed 
+ * to 256 layers and a 53-bit random number. R and V are the values for 256 
+ * layers from Doornik, "An Improved Ziggurat Method to Generate Normal 
+ * Random Samples". Everything is in double precision.
+ * 
+ * K  if the 53-bit random number is less than K[i], the spot is inside the 
+ *    curve for sure. (2^53 * x[i-1] / x[i])
+ * 
+ * W  multiply the 53-bit random number by W[i] to get x. (x[i] / 2^53)
+ * 
+ * F  the height of the curve at the edge of each layer. exp(-x[i]^2 / 2)
+ * 
+ * Example usage:
+ *      static const uint64_t K[PRNG_ZIGGURAT_SIZE] = PRNG_ZIGGURAT_K;
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef PRNG_ZIGGURAT_H
+#define PRNG_ZIGGURAT_H
+
+#define PRNG_ZIGGURAT_SIZE      256
+#define PRNG_ZIGGURAT_R         3.6541528853610088  // where the tail starts
+#define PRNG_ZIGGURAT_V         0.00492867323399    // area of each layer
+
+/* Arrays of 256 values. Leave off the semicolon! */
+#define PRNG_ZIGGURAT_K { \
+    8416190284920947ULL, 0ULL, 6774628846754132ULL, 7677520152659052ULL, \
+    8061537608569706ULL, 8273463477662850ULL, 8407514496123960ULL, 8499835136350465ULL, \
+    8567234683134558ULL, 8618578446237483ULL, 8658979550320583ULL, 8691591814763085ULL, \
+    8718465117470087ULL, 8740989007458224ULL, 8760138492417274ULL, 8776617738072653ULL, \
+    8790947915088034ULL, 8803522963558493ULL, 8814646152034174ULL, 8824554724428979ULL, \
+    8833436927219712ULL, 8841444029026801ULL, 8848698969548666ULL, 8855302690813572ULL, \
+    8861338844005866ULL, 8866877337946155ULL, 8871977048552789ULL, 8876687911856517ULL, \
+    8881052558151494ULL, 8885107600466198ULL, 8888884659728808ULL, 8892411187313549ULL, \
+    8895711130184076ULL, 8898805472677839ULL, 8901712680814989ULL, 8904449068990837ULL, \
+    8907029104419008ULL, 8909465661311690ULL, 8911770234216932ULL, 8913953117968370ULL, \
+    8916023560187258ULL, 8917989891099221ULL, 8919859634506764ULL, 8921639603032983ULL, \
+    8923335980176995ULL, 8924954391263249ULL, 8926499964999537ULL, 8927977387062535ULL, \
+    8929390946889872ULL, 8930744578662654ULL, 8932041897302797ULL, 8933286230178526ULL, \
+    8934480645103322ULL, 8935627975124157ULL, 8936730840520449ULL, 8937791668373126ULL, \
+    8938812710011249ULL, 8939796056599925ULL, 8940743653096490ULL, 8941657310770789ULL, \
+    8942538718458958ULL, 8943389452697679ULL, 8944210986866669ULL, 8945004699450818ULL, \
+    8945771881519230ULL, 8946513743506430ULL, 8947231421370463ULL, 8947925982193667ULL, \
+    8948598429284025ULL, 8949249706828286ULL, 8949880704142075ULL, 8950492259557096ULL, \
+    8951085163981048ULL, 8951660164161897ULL, 8952217965684740ULL, 8952759235726383ULL, \
+    8953284605590188ULL, 8953794673041287ULL, 8954290004460246ULL, 8954771136831346ULL, \
+    8955238579580123ULL, 8955692816273207ULL, 8956134306192367ULL, 8956563485793388ULL, \
+    8956980770059460ULL, 8957386553757799ULL, 8957781212607453ULL, 8958165104365423ULL, \
+    8958538569837653ULL, 8958901933820840ULL, 8959255505980417ULL, 8959599581669657ULL, \
+    8959934442694393ULL, 8960260358027436ULL, 8960577584476434ULL, 8960886367308626ULL, \
+    8961186940835588ULL, 8961479528960890ULL, 8961764345693266ULL, 8962041595627745ULL, \
+    8962311474396955ULL, 8962574169094642ULL, 8962829858673310ULL, 8963078714317695ULL, \
+    8963320899795673ULL, 8963556571788085ULL, 8963785880198839ULL, 8964008968446530ULL, \
+    8964225973738754ULL, 8964437027330181ULL, 8964642254765379ULL, 8964841776107297ULL, \
+    8965035706152275ULL, 8965224154632340ULL, 8965407226405534ULL, 8965585021634947ULL, \
+    8965757635957052ULL, 8965925160639953ULL, 8966087682732055ULL, 8966245285201657ULL, \
+    8966398047067923ULL, 8966546043523656ULL, 8966689346050266ULL, 8966828022525266ULL, \
+    8966962137322676ULL, 8967091751406581ULL, 8967216922418168ULL, 8967337704756474ULL, \
+    8967454149653080ULL, 8967566305240962ULL, 8967674216617702ULL, 8967777925903211ULL, \
+    8967877472292128ULL, 8967972892101036ULL, 8968064218810590ULL, 8968151483102689ULL, \
+    8968234712892753ULL, 8968313933357176ULL, 8968389166956015ULL, 8968460433450955ULL, \
+    8968527749918546ULL, 8968591130758759ULL, 8968650587698807ULL, 8968706129792232ULL, \
+    8968757763413213ULL, 8968805492246014ULL, 8968849317269534ULL, 8968889236736817ULL, \
+    8968925246149460ULL, 8968957338226741ULL, 8968985502869353ULL, 8969009727117536ULL, \
+    8969029995103450ULL, 8969046287997544ULL, 8969058583948667ULL, 8969066858017693ULL, \
+    8969071082104321ULL, 8969071224866729ULL, 8969067251633735ULL, 8969059124309045ULL, \
+    8969046801267160ULL, 8969030237240468ULL, 8969009383196996ULL, 8968984186208218ULL, \
+    8968954589306352ULL, 8968920531330395ULL, 8968881946760199ULL, 8968838765537728ULL, \
+    8968790912874633ULL, 8968738309045138ULL, 8968680869163176ULL, 8968618502942615ULL, \
+    8968551114439256ULL, 8968478601773210ULL, 8968400856830126ULL, 8968317764939530ULL, \
+    8968229204528444ULL, 8968135046748221ULL, 8968035155072334ULL, 8967929384862633ULL, \
+    8967817582901332ULL, 8967699586885679ULL, 8967575224881977ULL, 8967444314735228ULL, \
+    8967306663430302ULL, 8967162066400074ULL, 8967010306775436ULL, 8966851154571576ULL, \
+    8966684365804223ULL, 8966509681528852ULL, 8966326826795004ULL, 8966135509506982ULL, \
+    8965935419181038ULL, 8965726225588057ULL, 8965507577269295ULL, 8965279099911185ULL, \
+    8965040394563353ULL, 8964791035682066ULL, 8964530568978732ULL, 8964258509050525ULL, \
+    8963974336766888ULL, 8963677496382064ULL, 8963367392339478ULL, 8963043385728847ULL, \
+    8962704790351056ULL, 8962350868339047ULL, 8961980825274930ULL, 8961593804734187ULL, \
+    8961188882176582ULL, 8960765058090368ULL, 8960321250280539ULL, 8959856285173244ULL, \
+    8959368887986041ULL, 8958857671586717ULL, 8958321123830820ULL, 8957757593128693ULL, \
+    8957165271944704ULL, 8956542177872731ULL, 8955886131859835ULL, 8955194733060995ULL, \
+    8954465329697326ULL, 8953694985152301ULL, 8952880438367481ULL, 8952018057380786ULL, \
+    8951103784572767ULL, 8950133071831210ULL, 8949100803386929ULL, 8948001203479725ULL, \
+    8946827725236315ULL, 8945572916116506ULL, 8944228253917923ULL, 8942783945492901ULL, \
+    8941228677835351ULL, 8939549307766225ULL, 8937730471677702ULL, 8935754090078970ULL, \
+    8933598732090616ULL, 8931238791116700ULL, 8928643402399174ULL, 8925775002338468ULL, \
+    8922587382248582ULL, 8919023015271841ULL, 8915009316506028ULL, 8910453300649909ULL, \
+    8905233768484580ULL, 8899189566881475ULL, 8892101391295202ULL, 8883662533319100ULL, \
+    8873429784347971ULL, 8860736633794510ULL, 8844529650149292ULL, 8823034015404043ULL, \
+    8792993062619681ULL, 8747665408408210ULL, 8670250209926708ULL, 8502199523357717ULL}
+
+#define PRNG_ZIGGURAT_W { \
+    4.3418135304141737e-16, 2.3896650870688797e-17, 3.177176208205129e-17, 3.727435240246762e-17, \
+    4.1646834075866415e-17, 4.534030202263403e-17, 4.857430038048423e-17, 5.147375156908254e-17, \
+    5.4117151440297643e-17, 5.65573509787513e-17, 5.883179728344236e-17, 6.096808639200222e-17, \
+    6.298719957170385e-17, 6.4905499429915e-17, 6.673601868278261e-17, 6.848932421157756e-17, \
+    7.017411500498667e-17, 7.179764725910741e-17, 7.336604371068822e-17, 7.488452334086087e-17, \
+    7.635757501692294e-17, 7.77890908462791e-17, 7.91824700454605e-17, 8.054070087540927e-17, \
+    8.186642601891044e-17, 8.316199529119013e-17, 8.442950854249211e-17, 8.56708508819292e-17, \
+    8.688772182847568e-17, 8.808165961417567e-17, 8.925406158407255e-17, 9.040620142820192e-17, \
+    9.153924382335628e-17, 9.265425694232818e-17, 9.375222319612227e-17, 9.483404850314076e-17, \
+    9.590057032347353e-17, 9.695256465241881e-17, 9.799075213244969e-17, 9.901580341495823e-17, \
+    1.0002834388069532e-16, 1.0102895780969778e-16, 1.02018192076751e-16, 1.0299655943637851e-16, \
+    1.0396454145143972e-16, 1.0492259111123072e-16, 1.0587113517818965e-16, 1.0681057629664595e-16, \
+    1.0774129489231228e-16, 1.0866365088723492e-16, 1.0957798525155729e-16, 1.1048462141060512e-16, \
+    1.1138386652338366e-16, 1.1227601264651482e-16, 1.1316133779587836e-16, 1.1404010691670755e-16, \
+    1.1491257277158665e-16, 1.1577897675467358e-16, 1.1663954963949753e-16, 1.1749451226683654e-16, \
+    1.1834407617844563e-16, 1.1918844420176452e-16, 1.2002781099017417e-16, 1.208623635228794e-16, \
+    1.2169228156806472e-16, 1.225177381125895e-16, 1.2333889976115503e-16, 1.2415592710757905e-16, \
+    1.249689750805521e-16, 1.2577819326601702e-16, 1.2658372620810663e-16, 1.273857136903904e-16, \
+    1.2818429099901738e-16, 1.289795891691952e-16, 1.2977173521631455e-16, 1.3056085235291113e-16, \
+    1.3134706019255046e-16, 1.3213047494162762e-16, 1.3291120957998736e-16, 1.3368937403119398e-16, \
+    1.344650753232103e-16, 1.3523841774018292e-16, 1.3600950296597336e-16, 1.3677843022002424e-16, \
+    1.3754529638610207e-16, 1.3831019613441663e-16, 1.3907322203757765e-16, 1.398344646808152e-16, \
+    1.4059401276685794e-16, 1.4135195321583402e-16, 1.4210837126053347e-16, 1.4286335053734627e-16, \
+    1.436169731731682e-16, 1.4436931986854626e-16, 1.4512046997731719e-16, 1.458705015829752e-16, \
+    1.4661949157198985e-16, 1.4736751570428027e-16, 1.4811464868103959e-16, 1.4886096421009044e-16, \
+    1.4960653506894231e-16, 1.5035143316571082e-16, 1.5109572959804994e-16, 1.518394947102395e-16, \
+    1.5258279814856285e-16, 1.533257089151021e-16, 1.5406829542007168e-16, 1.5481062553280536e-16, \
+    1.5555276663150625e-16, 1.562947856518639e-16, 1.5703674913463857e-16, 1.5777872327230859e-16, \
+    1.5852077395487222e-16, 1.5926296681489332e-16, 1.6000536727187576e-16, 1.607480405760497e-16, \
+    1.6149105185165028e-16, 1.6223446613976653e-16, 1.6297834844083768e-16, 1.6372276375687117e-16, \
+    1.6446777713345637e-16, 1.6521345370164635e-16, 1.6595985871977952e-16, 1.6670705761531252e-16, \
+    1.674551160267348e-16, 1.6820409984563605e-16, 1.689540752589972e-16, 1.697051087917761e-16, \
+    1.704572673498598e-16, 1.7121061826345624e-16, 1.7196522933099873e-16, 1.7272116886363819e-16, \
+    1.7347850573039999e-16, 1.7423730940408327e-16, 1.7499765000798338e-16, 1.7575959836351978e-16, \
+    1.765232260388548e-16, 1.772886053985913e-16, 1.7805580965464063e-16, 1.7882491291835541e-16, \
+    1.7959599025402609e-16, 1.8036911773384383e-16, 1.811443724944375e-16, 1.819218327950968e-16, \
+    1.8270157807779967e-16, 1.8348368902916784e-16, 1.8426824764448008e-16, 1.8505533729388087e-16, \
+    1.8584504279092866e-16, 1.8663745046363626e-16, 1.8743264822816505e-16, 1.8823072566534355e-16, \
+    1.8903177410019166e-16, 1.8983588668464236e-16, 1.906431584836655e-16, 1.9145368656501024e-16, \
+    1.9226757009279751e-16, 1.9308491042520848e-16, 1.9390581121653183e-16, 1.9473037852385024e-16, \
+    1.9555872091866563e-16, 1.9639094960378389e-16, 1.9722717853580207e-16, 1.980675245535664e-16, \
+    1.9891210751299515e-16, 1.9976105042869066e-16, 2.0061447962279526e-16, 2.0147252488158159e-16, \
+    2.0233531962030407e-16, 2.0320300105688045e-16, 2.0407571039501622e-16, 2.0495359301743396e-16, \
+    2.0583679868992323e-16, 2.0672548177698505e-16, 2.0761980146990898e-16, 2.0851992202819166e-16, \
+    2.0942601303528279e-16, 2.1033824966972926e-16, 2.1125681299288228e-16, 2.1218189025443504e-16, \
+    2.1311367521717238e-16, 2.140523685024396e-16, 2.149981779579767e-16, 2.1595131904991781e-16, \
+    2.169120152809272e-16, 2.1788049863663138e-16, 2.1885701006271959e-16, 2.1984179997531754e-16, \
+    2.2083512880750293e-16, 2.2183726759512237e-16, 2.2284849860539744e-16, 2.2386911601217327e-16, \
+    2.248994266220753e-16, 2.25939750656302e-16, 2.26990422593302e-16, 2.280517920781727e-16, \
+    2.291242249052812e-16, 2.302081040813618e-16, 2.3130383097719773e-16, 2.3241182657696705e-16, \
+    2.335325328354395e-16, 2.3466641415447564e-16, 2.3581395899172804e-16, 2.3697568161610507e-16, \
+    2.3815212402646986e-16, 2.3934385805225037e-16, 2.4055148765718637e-16, 2.41775651470393e-16, \
+    2.4301702557235857e-16, 2.442763265674994e-16, 2.4555431497958406e-16, 2.468517990118386e-16, \
+    2.481696387200225e-16, 2.4950875065441555e-16, 2.5087011303573023e-16, 2.5225477154076347e-16, \
+    2.536638457865055e-16, 2.550985366169078e-16, 2.565601343151702e-16, 2.5805002788699383e-16, \
+    2.5956971558771873e-16, 2.611208168998469e-16, 2.627050862087164e-16, 2.643244284750852e-16, \
+    2.659809172667594e-16, 2.6767681559066564e-16, 2.6941460006654494e-16, 2.7119698910992937e-16, \
+    2.730269759535843e-16, 2.749078675444875e-16, 2.7684333062324214e-16, 2.7883744664617874e-16, \
+    2.808947776776224e-16, 2.8302044600397433e-16, 2.8522023106442435e-16, 2.8750068844585144e-16, \
+    2.898692972860882e-16, 2.923346446726343e-16, 2.9490665882375727e-16, 2.9759690748193647e-16, \
+    3.0041898481346175e-16, 3.0338902046654093e-16, 3.0652636043613485e-16, 3.098544947289545e-16, \
+    3.1340234816494007e-16, 3.17206120356254e-16, 3.213119829772846e-16, 3.257801658671349e-16, \
+    3.306913942547723e-16, 3.3615752312517293e-16, 3.4234017087811187e-16, 3.4948591681928653e-16, \
+    3.579997467414474e-16, 3.686212150898667e-16, 3.8294681854022677e-16, 4.056924668828242e-16}
+
+#define PRNG_ZIGGURAT_F { \
+    1.0, 0.9771017012827313, 0.9598790918124159, 0.945198953453078, \
+    0.9320600759689902, 0.9199915050483602, 0.9087264400605629, 0.898095921906304, \
+    0.8879846607633999, 0.8783096558161468, 0.8690086880437932, 0.8600336212030086, \
+    0.8513462584651237, 0.8429156531184411, 0.8347162929929304, 0.8267268339520942, \
+    0.8189291916094148, 0.8113078743182199, 0.8038494831763895, 0.7965423304282546, \
+    0.7893761435711986, 0.7823418326598619, 0.7754313049861383, 0.7686373158033348, \
+    0.7619533468415465, 0.7553735065117545, 0.7488924472237267, 0.7425052963446362, \
+    0.7362075981312667, 0.7299952645658024, 0.7238645334728816, 0.7178119326349014, \
+    0.7118342488823585, 0.7059285013367974, 0.7000919181404901, 0.6943219161300326, \
+    0.6886160830085271, 0.6829721616487914, 0.6773880362225131, 0.6718617199007664, \
+    0.6663913439123806, 0.6609751477802414, 0.6556114705832247, 0.6502987431142946, \
+    0.6450354808242519, 0.639820277456439, 0.63465179929096, 0.6295287799281283, \
+    0.6244500155502742, 0.6194143606090392, 0.6144207238920768, 0.6094680649288954, \
+    0.6045553907005495, 0.5996817526221677, 0.5948462437709913, 0.590047996335792, \
+    0.5852861792663003, 0.5805599961036835, 0.5758686829752105, 0.571211506738075, \
+    0.5665877632589518, 0.5619967758172779, 0.5574378936214863, 0.5529104904285199, \
+    0.5484139632579211, 0.5439477311926499, 0.5395112342595446, 0.5351039323830196, \
+    0.5307253044061939, 0.5263748471741867, 0.5220520746747949, 0.5177565172322006, \
+    0.513487720749743, 0.5092452459981361, 0.5050286679458288, 0.5008375751284821, \
+    0.4966715690547963, 0.49253026364614866, 0.48841328470771206, 0.4843202694289116, \
+    0.4802508659112497, 0.4762047327216838, 0.47218153846988326, 0.46818096140782217, \
+    0.46420268905027884, 0.4602464178149235, 0.45631185268077357, 0.4523987068638825, \
+    0.44850670150921407, 0.44463556539772775, 0.4407850346677699, 0.4369548525499293, \
+    0.43314476911457406, 0.4293545410313415, 0.4255839313399006, 0.4218327092313533, \
+    0.4181006498396846, 0.4143875340427068, 0.4106931482719832, 0.40701728433124795, \
+    0.4033597392228689, 0.39972031498193167, 0.3960988185175471, 0.39249506146101076, \
+    0.3889088600204646, 0.38534003484173396, 0.38178841087503135, 0.3782538172472381, \
+    0.3747360871394914, 0.37123505766982134, 0.3677505697805962, 0.3642824681305496, \
+    0.36083060099117575, 0.3573948201472905, 0.35397498080156925, 0.3505709414828812, \
+    0.3471825639582515, 0.34380971314829134, 0.34045225704594545, 0.3371100666384128, \
+    0.3337830158321085, 0.3304709813805371, 0.3271738428149586, 0.323891482377732, \
+    0.32062378495823013, 0.3173706380312224, 0.31413193159763014, 0.3109075581275637, \
+    0.30769741250555377, 0.3045013919778963, 0.3013193961020341, 0.29815132669790134, \
+    0.29499708780116257, 0.291856585618281, 0.28872972848335393, 0.2856164268166581, \
+    0.2825165930848494, 0.2794301417627653, 0.27635698929678126, 0.2732970540696758, \
+    0.27025025636696, 0.26721651834463184, 0.26419576399831757, 0.2611879191337637, \
+    0.258192911338648, 0.25521066995567715, 0.25224112605694377, 0.2492842124195167, \
+    0.24633986350223877, 0.243408015423712, 0.2404886059414491, 0.23758157443217368, \
+    0.2346868618732527, 0.23180441082524852, 0.22893416541557748, 0.22607607132326488, \
+    0.2232300757647896, 0.2203961274810116, 0.21757417672517837, 0.2147641752520085, \
+    0.21196607630785294, 0.20917983462193565, 0.20640540639867933, 0.2036427493111215, \
+    0.20089182249543133, 0.1981525865465381, 0.1954250035148856, 0.1927090369043288, \
+    0.19000465167119307, 0.18731181422451693, 0.18463049242750454, 0.1819606556002165, \
+    0.1793022745235304, 0.17665532144440665, 0.17401977008249936, 0.17139559563815562, \
+    0.16878277480185033, 0.16618128576511007, 0.16359110823298295, 0.16101222343811766, \
+    0.15844461415652022, 0.15588826472506456, 0.15334316106083767, 0.15080929068241017, \
+    0.14828664273312872, 0.14577520800653793, 0.14327497897404712, 0.1407859498149683, \
+    0.13830811644906432, 0.13584147657175735, 0.13338602969216284, 0.13094177717412817, \
+    0.12850872228047364, 0.12608687022065035, 0.1236762282020514, 0.12127680548523544, \
+    0.1188886134433457, 0.11651166562603701, 0.11414597782825521, 0.11179156816424558, \
+    0.10944845714721002, 0.10711666777507288, 0.10479622562286706, 0.10248715894230627, \
+    0.10018949876917202, 0.09790327903921563, 0.09562853671335333, 0.09336531191302662, \
+    0.09111364806670073, 0.08887359206859423, 0.08664519445086778, 0.08442850957065466, \
+    0.08222359581349568, 0.08003051581494751, 0.07784933670237221, 0.07568013035919496, \
+    0.07352297371424099, 0.07137794905914197, 0.06924514439725027, 0.06712465382802399, \
+    0.06501657797147044, 0.06292102443797785, 0.060838108349751806, 0.058767952921137984, \
+    0.05671069010639947, 0.054666461325077916, 0.05263541827697365, 0.05061772386112179, \
+    0.048613553216035145, 0.046623094902089664, 0.044646552251446536, 0.04268414491661938, \
+    0.04073611065607875, 0.03880270740465692, 0.03688421568869115, 0.03498094146183307, \
+    0.0330932194586887, 0.03122141719202369, 0.02936593975823011, 0.027527235669693315, \
+    0.025705804008632656, 0.023902203305873237, 0.022117062707379922, 0.020351096230109354, \
+    0.01860512127578335, 0.01688008315259584, 0.015177088307982072, 0.013497450601780807, \
+    0.011842757857943104, 0.0102149714397311, 0.008616582769422917, 0.00705087547139211, \
+    0.005522403299264754, 0.0040379725933718715, 0.002609072746106363, 0.001260285930498598}
+
+#endif /* PRNG_ZIGGURAT_H */
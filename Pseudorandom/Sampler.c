@@ -0,0 +1,288 @@
+/***************************************************************************//**
+ * @brief Weighted and Streaming Random Sampling
+ * 
+ * @file Sampler.c
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      See Sampler.h. Michael Vose, "A Linear Algorithm for Generating Random
+ * Numbers with a Given Distribution" for the alias table. Kim-Hung Li,
+ * "Reservoir-Sampling Algorithms of Time Complexity O(n(1 + log(N/n)))" for
+ * Algorithm L.
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#include "Sampler.h"
+#include <string.h>
+#include <math.h>
+
+// ***** Defines ***************************************************************
+
+/* A skip that is longer than this is as good as forever */
+#define RESERVOIR_MAX_SKIP      (1ULL << 62)
+
+// ***** Global Variables ******************************************************
+
+
+// ***** Static Function Prototypes ********************************************
+
+static void NextPick(SamplerReservoir *self);
+static double Uniform(PRNG *prng);
+
+// *****************************************************************************
+
+bool Sampler_AliasCreate(SamplerAlias *self, const uint32_t *weights, uint32_t n,
+    uint32_t *threshold, uint32_t *alias, uint32_t *work)
+{
+    uint64_t total = 0;
+    uint32_t numSmall = 0, numLarge = 0;
+
+    self->threshold = threshold;
+    self->alias = alias;
+    self->n = n;
+    self->total = 0;
+
+    for(uint32_t i = 0; i < n; i++)
+        total += weights[i];
+
+    if(n == 0 || total == 0 || total > UINT32_MAX)
+        return false;
+
+    self->total = (uint32_t)total;
+
+    /* Every weight is multiplied by n, so that the average is the total, and
+    each column is the total tall. Everything stays an integer. A weight
+    times n is less than the total times n, which fits in 64 bits. The small
+    ones (less than a full column) go on a stack at the front of the work
+    array, and the large ones go on a stack at the back. A small one always
+    fits in 32 bits, so it can go straight into the threshold. */
+    for(uint32_t i = 0; i < n; i++)
+    {
+        uint64_t scaled = (uint64_t)weights[i] * n;
+
+        if(scaled < total)
+        {
+            threshold[i] = (uint32_t)scaled;
+            work[numSmall++] = i;
+        }
+        else
+        {
+            work[n - 1 - numLarge++] = i;
+        }
+    }
+
+    /* Take a large one, and use it to fill up the rest of small columns
+    until what is left of it is small too. Then it gets its own column, and
+    the next large one takes over. Only the large one that is being used up
+    needs its 64-bit amount, so it is kept here instead of in an array. */
+    uint32_t large = 0;
+    uint64_t remaining = 0;
+    bool haveLarge = false;
+
+    while(numSmall > 0)
+    {
+        if(!haveLarge)
+        {
+            if(numLarge == 0)
+                break;
+
+            large = work[n - numLarge--];
+            remaining = (uint64_t)weights[large] * n;
+            haveLarge = true;
+        }
+
+        uint32_t small = work[--numSmall];
+        alias[small] = large;
+        remaining -= total - threshold[small];
+
+        if(remaining < total)
+        {
+            threshold[large] = (uint32_t)remaining;
+            work[numSmall++] = large;
+            haveLarge = false;
+        }
+    }
+
+    /* What is left fills its whole column. With integers, the amounts come
+    out exact, so these are all exactly full. */
+    if(haveLarge)
+    {
+        threshold[large] = (uint32_t)total;
+        alias[large] = large;
+    }
+    while(numLarge > 0)
+    {
+        uint32_t i = work[n - numLarge--];
+        threshold[i] = (uint32_t)total;
+        alias[i] = i;
+    }
+    while(numSmall > 0)
+    {
+        uint32_t i = work[--numSmall];
+        threshold[i] = (uint32_t)total;
+        alias[i] = i;
+    }
+    return true;
+}
+
+// *****************************************************************************
+
+uint32_t Sampler_AliasNext(SamplerAlias *self, PRNG *prng)
+{
+    uint32_t column = PRNG_NextBounded(prng, 0, self->n - 1);
+    uint32_t height = PRNG_NextBounded(prng, 0, self->total - 1);
+
+    return (height < self->threshold[column]) ? column : self->alias[column];
+}
+
+// *****************************************************************************
+
+void Sampler_AliasFill(SamplerAlias *self, PRNG *prng, uint32_t *out, size_t n)
+{
+    for(size_t i = 0; i < n; i++)
+        out[i] = Sampler_AliasNext(self, prng);
+}
+
+// *****************************************************************************
+
+void Sampler_ReservoirCreate(SamplerReservoir *self, PRNG *prng, void *reservoir, uint32_t k,
+    size_t s)
+{
+    self->prng = prng;
+    self->reservoir = reservoir;
+    self->k = k;
+    self->s = s;
+    self->count = 0;
+    self->next = 0;
+    self->w = 1.0;
+}
+
+// *****************************************************************************
+
+bool Sampler_ReservoirAdd(SamplerReservoir *self, const void *item)
+{
+    /* The first k items all go in */
+    if(self->count < self->k)
+    {
+        memcpy(self->reservoir + self->count * self->s, item, self->s);
+        self->count++;
+
+        if(self->count == self->k)
+        {
+            self->w = exp(log(Uniform(self->prng)) / self->k);
+            NextPick(self);
+        }
+        return true;
+    }
+
+    if(self->count != self->next)
+    {
+        self->count++;
+        return false;
+    }
+
+    /* This one replaces a random item */
+    uint32_t slot = PRNG_NextBounded(self->prng, 0, self->k - 1);
+    memcpy(self->reservoir + slot * self->s, item, self->s);
+    self->count++;
+
+    self->w *= exp(log(Uniform(self->prng)) / self->k);
+    NextPick(self);
+    return true;
+}
+
+// *****************************************************************************
+
+void Sampler_ReservoirAddArray(SamplerReservoir *self, const void *items, size_t n)
+{
+    const uint8_t *itemsPtr = items;
+    size_t i = 0;
+
+    for(; i < n && self->count < self->k; i++)
+        Sampler_ReservoirAdd(self, itemsPtr + i * self->s);
+
+    while(i < n)
+    {
+        uint64_t skip = self->next - self->count;
+
+        if(skip >= n - i)
+        {
+            self->count += n - i;
+            return;
+        }
+
+        i += skip;
+        self->count += skip;
+        Sampler_ReservoirAdd(self, itemsPtr + i * self->s);
+        i++;
+    }
+}
+
+// *****************************************************************************
+
+uint64_t Sampler_ReservoirGetSkip(SamplerReservoir *self)
+{
+    if(self->count < self->k)
+        return 0;
+
+    return self->next - self->count;
+}
+
+// *****************************************************************************
+
+void Sampler_ReservoirSkip(SamplerReservoir *self, uint64_t n)
+{
+    self->count += n;
+}
+
+// *****************************************************************************
+
+uint32_t Sampler_ReservoirGetSize(SamplerReservoir *self)
+{
+    return (self->count < self->k) ? (uint32_t)self->count : self->k;
+}
+
+// *****************************************************************************
+
+uint64_t Sampler_ReservoirGetCount(SamplerReservoir *self)
+{
+    return self->count;
+}
+
+// *****************************************************************************
+
+static void NextPick(SamplerReservoir *self)
+{
+    /* The number of items until the next one that goes in has a geometric
+    distribution, with w as the chance. log1p keeps it accurate when w is
+    tiny. */
+    double skip = floor(log(Uniform(self->prng)) / log1p(-self->w));
+
+    if(!(skip < (double)RESERVOIR_MAX_SKIP))
+        skip = (double)RESERVOIR_MAX_SKIP;
+
+    self->next = self->count + (uint64_t)skip;
+}
+
+// *****************************************************************************
+
+static double Uniform(PRNG *prng)
+{
+    /* Greater than 0 and up to 1, so that log works */
+    return 1.0 - PRNG_NextDouble01(prng);
+}
+
+/*
+ End of File
+ */
@@ -0,0 +1,270 @@
+/***************************************************************************//**
+ * @brief Weighted and Streaming Random Sampling
+ * 
+ * @file Sampler.h
+ * 
+ * @author Matthew Spinks <https://github.com/mspinksosu>
+ * 
+ * @date 10/16/26  Original creation
+ * 
+ * @details
+ *      Two ways to pick things at random, both using a PRNG object from
+ * PRNG.h for their random numbers. You make the PRNG and seed it, so you can
+ * use whatever type you like, and the same seed picks the same things.
+ * 
+ * The alias sampler picks an index from 0 to n - 1, where each one comes up
+ * in proportion to its weight. The obvious way is to add up the weights and
+ * search for where a random number lands, which takes O(log n) or O(n) for
+ * every pick. Vose's alias method does the work up front in O(n). The table
+ * has one column for each index, and every column is filled up to the same
+ * height. Part of it belongs to the index itself, and the rest belongs to
+ * one other index (the alias). A pick is just a random column and a random
+ * height, which is O(1) no matter how many weights there are. The weights are
+ * integers and so is the table, so there is no floating point at all. The
+ * chances come out exact, not rounded. That makes it good for a micro
+ * without an FPU.
+ * 
+ * The reservoir sampler keeps k items picked at random from a stream, when
+ * you don't know how long the stream is going to be. Every item has the same
+ * chance of ending up in the reservoir, k / n. The usual way (Algorithm R)
+ * needs a random number for every item. This uses Li's Algorithm L, which
+ * works out how many items to skip before the next one that goes in. For a
+ * long stream, almost everything is skipped, so the PRNG is only called
+ * about k * (1 + ln(n / k)) times instead of n. If your stream can skip
+ * ahead (like a file or a capture buffer), ask it how many items to skip,
+ * and you don't even have to read them. The skips use log and exp, so this
+ * one does need floating point.
+ * 
+ * Example usage:
+ *      uint32_t weights[4] = {10, 20, 30, 40};
+ *      uint32_t threshold[4], alias[4], work[4];
+ *      SamplerAlias sampler;
+ *      PRNG prng;
+ * 
+ *      PRNG_Create(&prng, PRNG_TYPE_PCG32);
+ *      PRNG_Seed(&prng, 1234);
+ *      Sampler_AliasCreate(&sampler, weights, 4, threshold, alias, work);
+ *      uint32_t category = Sampler_AliasNext(&sampler, &prng);
+ * 
+ * @section license License
+ * SPDX-FileCopyrightText: © 2026 Matthew Spinks
+ * SPDX-License-Identifier: Zlib
+ * 
+ * This software is released under the Zlib license. You are free alter and
+ * redistribute it, but you must not misrepresent the origin of the software.
+ * This notice may not be removed. <http://www.zlib.net/zlib_license.html>
+ * 
+ ******************************************************************************/
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include "PRNG.h"
+
+// ***** Defines ***************************************************************
+
+
+// ***** Global Variables ******************************************************
+
+typedef struct SamplerAliasTag
+{
+    uint32_t *threshold;
+    uint32_t *alias;
+    uint32_t n;
+    uint32_t total;
+} SamplerAlias;
+
+/**
+ * Description of struct members. You shouldn't really mess with any of these
+ * variables directly. That is why I made functions for you to use.
+ * 
+ * threshold  for each column, how much of it belongs to its own index.
+ *            Anything above that belongs to the alias.
+ * 
+ * alias  for each column, the index that owns the rest of it
+ * 
+ * n  number of weights
+ * 
+ * total  the sum of the weights. Every column is this tall.
+ */
+
+typedef struct SamplerReservoirTag
+{
+    PRNG *prng;
+    uint8_t *reservoir;
+    size_t s;
+    uint32_t k;
+    uint64_t count;
+    uint64_t next;
+    double w;
+} SamplerReservoir;
+
+/**
+ * Description of struct members.
+ * 
+ * prng  the PRNG that makes the random numbers
+ * 
+ * reservoir  pointer to the array of k items that you provided
+ * 
+ * s  the size in bytes of each item
+ * 
+ * k  number of items to keep
+ * 
+ * count  number of items seen so far
+ * 
+ * next  the number of the next item that goes into the reservoir
+ * 
+ * w  from Algorithm L. It gets smaller as the stream gets longer, which makes
+ *    the skips longer.
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+// ***** Function Prototypes *************************************************//
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************//**
+ * @brief Build an alias table from a list of weights
+ * 
+ * Index i will come up weights[i] / (sum of weights) of the time. A weight of
+ * 0 never comes up. The weights are only read while the table is being
+ * built, so you can throw them away afterwards. So can the work array.
+ * 
+ * @param self  pointer to the SamplerAlias that you are using
+ * 
+ * @param weights  pointer to n weights
+ * 
+ * @param n  number of weights. At least 1
+ * 
+ * @param threshold  pointer to an array of n uint32_t for the table
+ * 
+ * @param alias  pointer to an array of n uint32_t for the table
+ * 
+ * @param work  pointer to an array of n uint32_t of scratch space
+ * 
+ * @return bool  false if n is 0, or the weights add up to 0 or to more than
+ *               2^32 - 1. The table is not usable.
+ */
+bool Sampler_AliasCreate(SamplerAlias *self, const uint32_t *weights, uint32_t n,
+    uint32_t *threshold, uint32_t *alias, uint32_t *work);
+
+/***************************************************************************//**
+ * @brief Pick a random index
+ * 
+ * Takes two bounded numbers from the PRNG, one for the column and one for
+ * the height.
+ * 
+ * @param self  pointer to the SamplerAlias that you are using
+ * 
+ * @param prng  pointer to the PRNG that you are using
+ * 
+ * @return uint32_t  index from 0 to n - 1
+ */
+uint32_t Sampler_AliasNext(SamplerAlias *self, PRNG *prng);
+
+/***************************************************************************//**
+ * @brief Fill an array with random indexes
+ * 
+ * Same as calling Sampler_AliasNext n times.
+ * 
+ * @param self  pointer to the SamplerAlias that you are using
+ * 
+ * @param prng  pointer to the PRNG that you are using
+ * 
+ * @param out  pointer to an array of n uint32_t
+ * 
+ * @param n  number of indexes
+ */
+void Sampler_AliasFill(SamplerAlias *self, PRNG *prng, uint32_t *out, size_t n);
+
+/***************************************************************************//**
+ * @brief Start a reservoir sample of k items
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @param prng  pointer to the PRNG that you are using. It is kept, so it
+ *              has to stay around as long as the sampler does.
+ * 
+ * @param reservoir  pointer to an array of k items of any type
+ * 
+ * @param k  number of items to keep. At least 1
+ * 
+ * @param s  the size in bytes of each item
+ */
+void Sampler_ReservoirCreate(SamplerReservoir *self, PRNG *prng, void *reservoir, uint32_t k,
+    size_t s);
+
+/***************************************************************************//**
+ * @brief Give the sampler the next item in the stream
+ * 
+ * The item is copied into the reservoir if it is picked. Most of the time,
+ * it isn't, and that only costs a compare.
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @param item  pointer to the item
+ * 
+ * @return bool  true if the item went into the reservoir
+ */
+bool Sampler_ReservoirAdd(SamplerReservoir *self, const void *item);
+
+/***************************************************************************//**
+ * @brief Give the sampler the next n items in the stream
+ * 
+ * Same as calling Sampler_ReservoirAdd for each one, but it jumps straight
+ * to the items that are picked.
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @param items  pointer to an array of n items
+ * 
+ * @param n  number of items
+ */
+void Sampler_ReservoirAddArray(SamplerReservoir *self, const void *items, size_t n);
+
+/***************************************************************************//**
+ * @brief How many of the next items won't go into the reservoir
+ * 
+ * If your stream can skip ahead, skip this many items and tell the sampler
+ * with Sampler_ReservoirSkip. Then give it the item after that.
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @return uint64_t  number of items that can be skipped
+ */
+uint64_t Sampler_ReservoirGetSkip(SamplerReservoir *self);
+
+/***************************************************************************//**
+ * @brief Tell the sampler that n items went by without being added
+ * 
+ * n has to be no more than Sampler_ReservoirGetSkip, or every item won't have
+ * the same chance any more.
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @param n  number of items that were skipped
+ */
+void Sampler_ReservoirSkip(SamplerReservoir *self, uint64_t n);
+
+/***************************************************************************//**
+ * @brief Get the number of items in the reservoir
+ * 
+ * This is k, unless the stream has been shorter than k so far.
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @return uint32_t  number of items
+ */
+uint32_t Sampler_ReservoirGetSize(SamplerReservoir *self);
+
+/***************************************************************************//**
+ * @brief Get the number of items in the stream so far
+ * 
+ * @param self  pointer to the SamplerReservoir that you are using
+ * 
+ * @return uint64_t  number of items, including the ones that were skipped
+ */
+uint64_t Sampler_ReservoirGetCount(SamplerReservoir *self);
+
+#endif  /* SAMPLER_H */
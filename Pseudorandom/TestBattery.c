@@ -0,0 +1,356 @@
+/* Program to test the quality and speed of every PRNG type - MS
+
+   Runs the same battery of tests on every type, with no menus and no output
+   files to look through. The statistical tests all use 32-bit numbers made
+   from PRNG_NextDouble01, so that the small LCG and the Park Miller, which
+   don't give 32 bits in one number, are tested the same way as the rest.
+
+   chi-square      the top 16 bits into 65536 bins
+   serial          correlation between each number and the next one
+   gap             how long until a number lands in [0, 1/16) again
+   birthday        Marsaglia's birthday spacings. 4096 birthdays in a year
+                   of 2^32 days, sorted. The number of repeated spacings
+                   between them should be Poisson with a mean of 4.
+   skip            PRNG_Skip forwards, backwards, and far away against the
+                   same number of PRNG_Next calls
+   PRNG_Next ns    nanoseconds per number, one call per number
+   PRNG_Fill ns    nanoseconds per number, all at once
+
+   Prints one CSV line per test per type. The statistical tests fail if the
+   p-value is too close to 0 or too close to 1 (too good to be random).
+   Every type has a fixed seed, so the results are the same every time. Ends
+   with PASS or FAIL and returns 1 if anything failed.
+
+   Some of the old types are known to fail some tests, and those show up as
+   WEAK instead, which doesn't count as a failure. The small LCG has a period
+   of 2^31 and only 16 bits in each number, so a 16 million number sample is
+   too even. It and the Park Miller (and the Schrage, which is the same
+   thing) fail the birthday spacings because their numbers fall on a lattice.
+   If one of those starts to pass, or anything else fails, that is news.
+
+   gcc -O2 TestBattery.c PRNG.c -o TestBattery -lm
+   ./TestBattery [numValues] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "PRNG.h"
+
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#define BATCH_SIZE          4096
+#define P_FAIL              1e-4
+
+#define NUM_BINS            65536
+#define GAP_LIMIT           (1.0 / 16)
+#define NUM_GAP_LENGTHS     128
+#define NUM_BIRTHDAYS       4096
+#define BIRTHDAY_MEAN       4.0
+#define NUM_BIRTHDAY_COUNTS 12
+#define SKIP_LENGTH         10000
+
+#define TEST_CHI_SQUARE     (1 << 0)
+#define TEST_SERIAL         (1 << 1)
+#define TEST_GAP            (1 << 2)
+#define TEST_BIRTHDAY       (1 << 3)
+
+static const char *names[] = {"LCG Big", "LCG Small", "Park Miller", "Schrage", "PCG32",
+                              "xoshiro256**", "SplitMix64"};
+static const uint32_t weak[] = {0, TEST_CHI_SQUARE | TEST_BIRTHDAY, TEST_BIRTHDAY,
+                                TEST_BIRTHDAY, 0, 0, 0};
+static size_t numValues = DEFAULT_NUM_VALUES;
+static uint32_t batch[BATCH_SIZE];
+static double doubles[BATCH_SIZE];
+static int errors;
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* The next n numbers, 32 random bits each */
+static void Next32(PRNG *prng, uint32_t *out, size_t n)
+{
+    PRNG_FillDouble01(prng, doubles, n);
+    for(size_t i = 0; i < n; i++)
+        out[i] = (uint32_t)(doubles[i] * 4294967296.0);
+}
+
+/* The chance of chi-square with df degrees of freedom coming out at least
+this big. Wilson and Hilferty's cube root is close enough to the real thing
+for the p-values that matter here. */
+static double ChiSquareP(double chiSquare, double df)
+{
+    double z = (cbrt(chiSquare / df) - (1 - 2 / (9 * df))) / sqrt(2 / (9 * df));
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+static void Result(PRNGType type, uint32_t test, const char *testName, double statistic,
+    double p)
+{
+    bool failed = (p < P_FAIL || p > 1 - P_FAIL);
+    const char *result = failed ? "FAIL" : "PASS";
+
+    if(weak[type] & test)
+    {
+        result = failed ? "WEAK" : "PASS";
+    }
+    else if(failed)
+    {
+        errors++;
+    }
+    printf("%s,%s,%.4f,%.6f,%s\n", names[type], testName, statistic, p, result);
+}
+
+static int CompareUint32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// *****************************************************************************
+
+static void ChiSquare(PRNGType type, PRNG *prng)
+{
+    static uint32_t count[NUM_BINS];
+    size_t n = numValues - numValues % BATCH_SIZE;
+    double expected = (double)n / NUM_BINS;
+    double chiSquare = 0;
+
+    memset(count, 0, sizeof(count));
+    for(size_t i = 0; i < n; i += BATCH_SIZE)
+    {
+        Next32(prng, batch, BATCH_SIZE);
+        for(uint32_t j = 0; j < BATCH_SIZE; j++)
+            count[batch[j] >> 16]++;
+    }
+
+    for(uint32_t bin = 0; bin < NUM_BINS; bin++)
+        chiSquare += (count[bin] - expected) * (count[bin] - expected) / expected;
+
+    Result(type, TEST_CHI_SQUARE, "chi-square", chiSquare,
+        ChiSquareP(chiSquare, NUM_BINS - 1));
+}
+
+// *****************************************************************************
+
+static void Serial(PRNGType type, PRNG *prng)
+{
+    /* The correlation of n pairs of independent numbers is close to normal,
+    with a standard deviation of 1 / sqrt(n). */
+    size_t n = numValues - numValues % BATCH_SIZE;
+    double sum = 0, sumSquares = 0, sumProducts = 0, previous = 0, first = 0;
+
+    for(size_t i = 0; i < n; i += BATCH_SIZE)
+    {
+        PRNG_FillDouble01(prng, doubles, BATCH_SIZE);
+        if(i == 0)
+            first = previous = doubles[0];
+        for(uint32_t j = (i == 0) ? 1 : 0; j < BATCH_SIZE; j++)
+        {
+            sum += previous;
+            sumSquares += previous * previous;
+            sumProducts += previous * doubles[j];
+            previous = doubles[j];
+        }
+    }
+
+    /* Wrap around so that every number has a next one */
+    sum += previous;
+    sumSquares += previous * previous;
+    sumProducts += previous * first;
+
+    double correlation = (n * sumProducts - sum * sum) / (n * sumSquares - sum * sum);
+    double z = correlation * sqrt((double)n);
+
+    Result(type, TEST_SERIAL, "serial", correlation, erfc(fabs(z) / sqrt(2.0)));
+}
+
+// *****************************************************************************
+
+static void Gap(PRNGType type, PRNG *prng)
+{
+    /* A gap of length r has a chance of p(1 - p)^r. Everything
+    NUM_GAP_LENGTHS and up goes in the last bin. */
+    uint32_t count[NUM_GAP_LENGTHS + 1] = {0};
+    size_t n = numValues - numValues % BATCH_SIZE;
+    uint32_t length = 0;
+    uint64_t numGaps = 0;
+    double chiSquare = 0;
+
+    for(size_t i = 0; i < n; i += BATCH_SIZE)
+    {
+        PRNG_FillDouble01(prng, doubles, BATCH_SIZE);
+        for(uint32_t j = 0; j < BATCH_SIZE; j++)
+        {
+            if(doubles[j] < GAP_LIMIT)
+            {
+                count[(length < NUM_GAP_LENGTHS) ? length : NUM_GAP_LENGTHS]++;
+                numGaps++;
+                length = 0;
+            }
+            else
+            {
+                length++;
+            }
+        }
+    }
+
+    for(uint32_t r = 0; r <= NUM_GAP_LENGTHS; r++)
+    {
+        double chance = (r < NUM_GAP_LENGTHS) ? GAP_LIMIT * pow(1 - GAP_LIMIT, r) :
+            pow(1 - GAP_LIMIT, NUM_GAP_LENGTHS);
+        double expected = chance * numGaps;
+        chiSquare += (count[r] - expected) * (count[r] - expected) / expected;
+    }
+
+    Result(type, TEST_GAP, "gap", chiSquare, ChiSquareP(chiSquare, NUM_GAP_LENGTHS));
+}
+
+// *****************************************************************************
+
+static void Birthday(PRNGType type, PRNG *prng)
+{
+    /* With m birthdays in a year of n days, the number of repeated spacings
+    is Poisson with a mean of m^3 / 4n. Everything NUM_BIRTHDAY_COUNTS - 1 and
+    up goes in the last bin. */
+    uint32_t days[NUM_BIRTHDAYS], count[NUM_BIRTHDAY_COUNTS] = {0};
+    uint32_t numYears = numValues / NUM_BIRTHDAYS;
+    double chiSquare = 0, chance = exp(-BIRTHDAY_MEAN), total = 0;
+
+    if(numYears > 4096)
+        numYears = 4096;
+
+    for(uint32_t year = 0; year < numYears; year++)
+    {
+        uint32_t repeats = 0;
+
+        Next32(prng, days, NUM_BIRTHDAYS);
+        qsort(days, NUM_BIRTHDAYS, sizeof(uint32_t), CompareUint32);
+        for(uint32_t i = NUM_BIRTHDAYS - 1; i > 0; i--)
+            days[i] -= days[i - 1];
+        qsort(days, NUM_BIRTHDAYS, sizeof(uint32_t), CompareUint32);
+        for(uint32_t i = 1; i < NUM_BIRTHDAYS; i++)
+        {
+            if(days[i] == days[i - 1])
+                repeats++;
+        }
+        count[(repeats < NUM_BIRTHDAY_COUNTS - 1) ? repeats : NUM_BIRTHDAY_COUNTS - 1]++;
+    }
+
+    for(uint32_t j = 0; j < NUM_BIRTHDAY_COUNTS; j++)
+    {
+        double expected = ((j < NUM_BIRTHDAY_COUNTS - 1) ? chance : 1 - total) * numYears;
+        chiSquare += (count[j] - expected) * (count[j] - expected) / expected;
+        total += chance;
+        chance *= BIRTHDAY_MEAN / (j + 1);
+    }
+
+    Result(type, TEST_BIRTHDAY, "birthday", chiSquare,
+        ChiSquareP(chiSquare, NUM_BIRTHDAY_COUNTS - 1));
+}
+
+// *****************************************************************************
+
+static void Skip(PRNGType type)
+{
+    /* sequence[i] is what the ith call to PRNG_Next gave. PRNG_Skip(n)
+    should give the same thing as calling PRNG_Next n times, and leave the
+    PRNG in the same place. */
+    static uint32_t sequence[SKIP_LENGTH + 1];
+    const uint32_t seeds[] = {1, 12345, 0x80000000, 0xFFFFFFFF};
+    const int64_t far = 1000000000007LL;
+    uint32_t mismatches = 0;
+    PRNG a, b;
+
+    for(uint32_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]); s++)
+    {
+        PRNG_Create(&a, type);
+        PRNG_Seed(&a, seeds[s]);
+        for(uint32_t i = 1; i <= SKIP_LENGTH; i++)
+            sequence[i] = PRNG_Next(&a);
+
+        for(uint32_t n = 1; n <= SKIP_LENGTH; n += (n < 100) ? 1 : 997)
+        {
+            PRNG_Create(&b, type);
+            PRNG_Seed(&b, seeds[s]);
+            if(PRNG_Skip(&b, n) != sequence[n])
+                mismatches++;
+            if(n < SKIP_LENGTH && PRNG_Next(&b) != sequence[n + 1])
+                mismatches++;
+            if(n > 1 && PRNG_Skip(&b, -(int64_t)(n / 2) - 1) != sequence[n - n / 2])
+                mismatches++;
+        }
+
+        /* Far away and back again, the long way around for the ones that
+        have a short period */
+        PRNG_Create(&b, type);
+        PRNG_Seed(&b, seeds[s]);
+        PRNG_Skip(&b, far);
+        PRNG_Skip(&b, far);
+        if(PRNG_Skip(&b, 5 - 2 * far) != sequence[5] || PRNG_Next(&b) != sequence[6])
+            mismatches++;
+    }
+
+    printf("%s,skip,%u,,%s\n", names[type], mismatches, mismatches ? "FAIL" : "PASS");
+    if(mismatches)
+        errors++;
+}
+
+// *****************************************************************************
+
+static void Speed(PRNGType type, PRNG *prng)
+{
+    static volatile uint32_t sink;
+    uint32_t sum = 0;
+    size_t n = numValues - numValues % BATCH_SIZE;
+    double start = Seconds();
+
+    for(size_t i = 0; i < n; i++)
+        sum += PRNG_Next(prng);
+    printf("%s,PRNG_Next ns,%.3f,,\n", names[type], (Seconds() - start) * 1e9 / n);
+
+    start = Seconds();
+    for(size_t i = 0; i < n; i += BATCH_SIZE)
+    {
+        PRNG_Fill(prng, batch, BATCH_SIZE);
+        sum += batch[BATCH_SIZE - 1];
+    }
+    printf("%s,PRNG_Fill ns,%.3f,,\n", names[type], (Seconds() - start) * 1e9 / n);
+    sink += sum;
+}
+
+// *****************************************************************************
+
+int main(int argc, char *argv[])
+{
+    PRNG prng;
+
+    if(argc > 1)
+        numValues = strtoull(argv[1], NULL, 0);
+
+    if(numValues < BATCH_SIZE * 16)
+        numValues = BATCH_SIZE * 16;
+
+    printf("type,test,statistic,p-value,result\n");
+
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        PRNG_Create(&prng, type);
+        PRNG_Seed(&prng, 2024);
+
+        ChiSquare(type, &prng);
+        Serial(type, &prng);
+        Gap(type, &prng);
+        Birthday(type, &prng);
+        Skip(type);
+        Speed(type, &prng);
+    }
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
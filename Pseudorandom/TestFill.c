@@ -0,0 +1,173 @@
+/* Program to test PRNG_Fill and PRNG_FillBounded - MS
+
+   For every type, fills arrays of different lengths and checks that they
+   match PRNG_Next called the same number of times, and that the PRNG ends up
+   in the same state afterwards. Does the same for PRNG_FillBounded against
+   PRNG_NextBounded, with ranges that throw away a lot of numbers, and checks
+   that a small range comes out even. Then times both fills against a loop.
+   Returns 1 if anything doesn't match.
+
+   gcc -O2 TestFill.c PRNG.c -o TestFill -lm
+   ./TestFill [numValues] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "PRNG.h"
+
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#define MAX_CHECK_LENGTH    300
+#define NUM_BINS            6
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    const uint32_t seeds[] = {0, 1, 12345, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF};
+    const char *names[] = {"LCG Big", "LCG Small", "Park Miller", "Schrage", "PCG32",
+                           "xoshiro256**", "SplitMix64"};
+    uint32_t expected[MAX_CHECK_LENGTH], result[MAX_CHECK_LENGTH];
+    size_t numValues = DEFAULT_NUM_VALUES;
+    volatile uint32_t sink = 0;
+    int errors = 0;
+    PRNG a, b;
+
+    if(argc > 1)
+        numValues = strtoull(argv[1], NULL, 0);
+
+    uint32_t *values = malloc(numValues * sizeof(uint32_t));
+
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        for(uint32_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]); s++)
+        {
+            for(size_t length = 0; length < MAX_CHECK_LENGTH; length += (length < 40) ? 1 : 37)
+            {
+                a.type = b.type = type;
+                PRNG_Seed(&a, seeds[s]);
+                PRNG_Seed(&b, seeds[s]);
+
+                for(size_t i = 0; i < length; i++)
+                    expected[i] = PRNG_Next(&a);
+                PRNG_Fill(&b, result, length);
+
+                /* The next number tells me if the state is the same */
+                if(memcmp(expected, result, length * sizeof(uint32_t)) != 0 ||
+                    PRNG_Next(&a) != PRNG_Next(&b))
+                {
+                    printf("FAIL %s seed 0x%X length %u\n", names[type], seeds[s],
+                        (unsigned)length);
+                    errors++;
+                }
+            }
+        }
+    }
+
+    /* Ranges of 1, small, just over half (almost half get thrown away), and 
+    everything */
+    const uint32_t bounds[][2] = {{5, 5}, {1, NUM_BINS}, {0, 0x80000000}, {100, 7},
+                                  {0, 0xFFFFFFFF}};
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        for(uint32_t r = 0; r < sizeof(bounds) / sizeof(bounds[0]); r++)
+        {
+            uint32_t lower = bounds[r][0], upper = bounds[r][1];
+
+            for(size_t length = 0; length < MAX_CHECK_LENGTH; length += 23)
+            {
+                PRNG_Create(&a, type);
+                PRNG_Create(&b, type);
+                PRNG_Seed(&a, length + 1);
+                PRNG_Seed(&b, length + 1);
+
+                for(size_t i = 0; i < length; i++)
+                    expected[i] = PRNG_NextBounded(&a, lower, upper);
+                PRNG_FillBounded(&b, result, length, lower, upper);
+
+                if(memcmp(expected, result, length * sizeof(uint32_t)) != 0 ||
+                    PRNG_Next(&a) != PRNG_Next(&b))
+                {
+                    printf("FAIL bounded %s %u to %u length %u\n", names[type], lower,
+                        upper, (unsigned)length);
+                    errors++;
+                }
+
+                for(size_t i = 0; i < length; i++)
+                {
+                    if(result[i] < ((lower < upper) ? lower : upper) ||
+                        result[i] > ((lower < upper) ? upper : lower))
+                    {
+                        printf("FAIL bounded %s %u out of range\n", names[type], result[i]);
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /* Like rolling a die. Every side should come up about the same. 
+        Chi-square with 5 degrees of freedom is over 20.5 one time in 1000. */
+        uint32_t count[NUM_BINS] = {0};
+        uint32_t numRolls = 600000;
+        PRNG_Seed(&a, 99);
+        for(uint32_t i = 0; i < numRolls; i++)
+            count[PRNG_NextBounded(&a, 0, NUM_BINS - 1)]++;
+
+        double chiSquare = 0;
+        for(uint32_t i = 0; i < NUM_BINS; i++)
+        {
+            double diff = count[i] - (double)numRolls / NUM_BINS;
+            chiSquare += diff * diff / ((double)numRolls / NUM_BINS);
+        }
+        if(chiSquare > 20.5)
+        {
+            printf("FAIL bounded %s chi-square %.1f\n", names[type], chiSquare);
+            errors++;
+        }
+    }
+
+    printf("type,PRNG_Next ns/value,PRNG_Fill ns/value,speedup,"
+           "PRNG_NextBounded ns/value,PRNG_FillBounded ns/value,speedup\n");
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        a.type = b.type = type;
+        PRNG_Seed(&a, 1);
+        PRNG_Seed(&b, 1);
+
+        double start = Seconds();
+        for(size_t i = 0; i < numValues; i++)
+            values[i] = PRNG_Next(&a);
+        double nextTime = Seconds() - start;
+        sink += values[numValues - 1];
+
+        start = Seconds();
+        PRNG_Fill(&b, values, numValues);
+        double fillTime = Seconds() - start;
+        sink += values[numValues - 1];
+
+        start = Seconds();
+        for(size_t i = 0; i < numValues; i++)
+            values[i] = PRNG_NextBounded(&a, 0, 999);
+        double nextBoundedTime = Seconds() - start;
+        sink += values[numValues - 1];
+
+        start = Seconds();
+        PRNG_FillBounded(&b, values, numValues, 0, 999);
+        double fillBoundedTime = Seconds() - start;
+        sink += values[numValues - 1];
+
+        printf("%s,%.3f,%.3f,%.1f,%.3f,%.3f,%.1f\n", names[type], nextTime * 1e9 / numValues,
+            fillTime * 1e9 / numValues, nextTime / fillTime, nextBoundedTime * 1e9 / numValues,
+            fillBoundedTime * 1e9 / numValues, nextBoundedTime / fillBoundedTime);
+    }
+    free(values);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
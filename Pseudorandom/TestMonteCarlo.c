@@ -0,0 +1,150 @@
+/* Program to test PRNG_SplitStreams with a multi-threaded Monte Carlo - MS
+
+   Estimates pi by throwing random points at a square and counting how many
+   land inside the circle. The job is cut into a fixed number of blocks, and
+   each block gets its own stream from PRNG_SplitStreams. A pool of threads
+   grabs the next block until they are all done. Each block uses exactly
+   blockLength numbers, so the streams back to back are the same as the
+   parent PRNG by itself. The hit count must come out exactly the same as one
+   thread running straight through the parent, no matter how many threads
+   there are. Prints the time for each thread count. Returns 1 if any of the
+   results don't match.
+
+   gcc -O2 -pthread TestMonteCarlo.c PRNG.c -o TestMonteCarlo -lm
+   ./TestMonteCarlo [pointsPerBlock] [maxThreads] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "PRNG.h"
+
+#define NUM_BLOCKS                  256
+#define DEFAULT_POINTS_PER_BLOCK    (256UL * 1024)
+#define MAX_THREADS                 64
+
+static PRNG streams[NUM_BLOCKS];
+static uint64_t blockHits[NUM_BLOCKS];
+static uint64_t pointsPerBlock = DEFAULT_POINTS_PER_BLOCK;
+static uint32_t nextBlock;
+static pthread_mutex_t nextBlockLock = PTHREAD_MUTEX_INITIALIZER;
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* Two numbers per point. Use the top 31 bits of each so that x^2 + y^2 can't
+overflow. Inside the circle if x^2 + y^2 < r^2 */
+static uint64_t CountHits(PRNG *prng, uint64_t numPoints)
+{
+    uint64_t hits = 0;
+
+    for(uint64_t i = 0; i < numPoints; i++)
+    {
+        uint64_t x = PRNG_Next(prng) >> 1;
+        uint64_t y = PRNG_Next(prng) >> 1;
+
+        if(x * x + y * y < (1ULL << 62))
+            hits++;
+    }
+    return hits;
+}
+
+static void *Worker(void *arg)
+{
+    (void)arg;
+
+    while(1)
+    {
+        pthread_mutex_lock(&nextBlockLock);
+        uint32_t block = nextBlock++;
+        pthread_mutex_unlock(&nextBlockLock);
+
+        if(block >= NUM_BLOCKS)
+            break;
+
+        /* Each block writes its own slot, so the total doesn't depend on
+        which thread ran it or when */
+        blockHits[block] = CountHits(&streams[block], pointsPerBlock);
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t maxThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_t threads[MAX_THREADS];
+    int errors = 0;
+    PRNG parent, single;
+
+    if(argc > 1)
+        pointsPerBlock = strtoull(argv[1], NULL, 0);
+    if(argc > 2)
+        maxThreads = strtoul(argv[2], NULL, 0);
+    if(maxThreads < 4)
+        maxThreads = 4;
+    if(maxThreads > MAX_THREADS)
+        maxThreads = MAX_THREADS;
+
+    parent.type = PRNG_TYPE_LCG_BIG;
+    PRNG_Seed(&parent, 12345);
+
+    /* The answer to match. One thread, straight through the parent */
+    single = parent;
+    double start = Seconds();
+    uint64_t expected = CountHits(&single, NUM_BLOCKS * pointsPerBlock);
+    double singleTime = Seconds() - start;
+
+    printf("threads,seconds,speedup,pi,match\n");
+    printf("single,%.3f,1.00,%.9f,reference\n", singleTime,
+        4.0 * expected / (NUM_BLOCKS * pointsPerBlock));
+
+    for(uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        PRNG_SplitStreams(&parent, NUM_BLOCKS, streams, 2 * pointsPerBlock);
+        nextBlock = 0;
+
+        start = Seconds();
+        for(uint32_t t = 0; t < numThreads; t++)
+            pthread_create(&threads[t], NULL, Worker, NULL);
+        for(uint32_t t = 0; t < numThreads; t++)
+            pthread_join(threads[t], NULL);
+
+        uint64_t hits = 0;
+        for(uint32_t i = 0; i < NUM_BLOCKS; i++)
+            hits += blockHits[i];
+        double elapsed = Seconds() - start;
+
+        if(hits != expected)
+            errors++;
+
+        printf("%u,%.3f,%.2f,%.9f,%s\n", numThreads, elapsed, singleTime / elapsed,
+            4.0 * hits / (NUM_BLOCKS * pointsPerBlock), (hits == expected) ? "yes" : "NO");
+    }
+
+    /* Every type must split up the same way */
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        parent.type = type;
+        PRNG_Seed(&parent, 777);
+        PRNG_SplitStreams(&parent, 4, streams, 1000);
+        single = parent;
+
+        for(uint32_t i = 0; i < 4 * 1000; i++)
+        {
+            if(PRNG_Next(&single) != PRNG_Next(&streams[i / 1000]))
+            {
+                printf("FAIL type %u number %u\n", type, i);
+                errors++;
+                break;
+            }
+        }
+    }
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
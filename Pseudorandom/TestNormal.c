@@ -0,0 +1,268 @@
+/* Program to test the float, double, and normal distribution functions - MS
+
+   For every type, checks that PRNG_FillFloat01, PRNG_FillDouble01, and
+   PRNG_FillNormal give the same numbers as calling the Next functions one at
+   a time, and leave the PRNG in the same state. Checks that floats and
+   doubles never come out as 1.0. Then makes a lot of normal numbers and
+   checks the mean, the variance, the kurtosis, how many land past the start
+   of the ziggurat tail, and how they fill up bins compared to the bell curve.
+   Then times everything against the old ways, dividing by 2^32 and
+   Box-Muller. Returns 1 if anything doesn't match.
+
+   gcc -O2 TestNormal.c PRNG.c -o TestNormal -lm
+   ./TestNormal [numValues] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "PRNG.h"
+
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#define MAX_CHECK_LENGTH    600
+#define NUM_BINS            32
+#define BIN_WIDTH           0.25
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* The chance of landing below x on the bell curve */
+static double NormalCDF(double x)
+{
+    return 0.5 * erfc(-x / sqrt(2.0));
+}
+
+/* The old way. Two uniform numbers in, one normal number out. */
+static double BoxMuller(PRNG *prng)
+{
+    double u1 = (PRNG_Next(prng) + 1.0) / 4294967296.0;
+    double u2 = PRNG_Next(prng) / 4294967296.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *names[] = {"LCG Big", "LCG Small", "Park Miller", "Schrage", "PCG32",
+                           "xoshiro256**", "SplitMix64"};
+    float expectedFloat[MAX_CHECK_LENGTH], resultFloat[MAX_CHECK_LENGTH];
+    double expected[MAX_CHECK_LENGTH], result[MAX_CHECK_LENGTH];
+    size_t numValues = DEFAULT_NUM_VALUES;
+    volatile double sink = 0;
+    int errors = 0;
+    PRNG a, b;
+
+    if(argc > 1)
+        numValues = strtoull(argv[1], NULL, 0);
+
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        for(size_t length = 0; length < MAX_CHECK_LENGTH; length += (length < 40) ? 1 : 71)
+        {
+            PRNG_Create(&a, type);
+            PRNG_Create(&b, type);
+            PRNG_Seed(&a, length + 1);
+            PRNG_Seed(&b, length + 1);
+
+            for(size_t i = 0; i < length; i++)
+                expectedFloat[i] = PRNG_NextFloat01(&a);
+            PRNG_FillFloat01(&b, resultFloat, length);
+
+            if(memcmp(expectedFloat, resultFloat, length * sizeof(float)) != 0 ||
+                PRNG_Next(&a) != PRNG_Next(&b))
+            {
+                printf("FAIL float %s length %u\n", names[type], (unsigned)length);
+                errors++;
+            }
+
+            for(size_t i = 0; i < length; i++)
+                expected[i] = PRNG_NextDouble01(&a);
+            PRNG_FillDouble01(&b, result, length);
+
+            if(memcmp(expected, result, length * sizeof(double)) != 0 ||
+                PRNG_Next(&a) != PRNG_Next(&b))
+            {
+                printf("FAIL double %s length %u\n", names[type], (unsigned)length);
+                errors++;
+            }
+
+            for(size_t i = 0; i < length; i++)
+                expected[i] = PRNG_NextNormal(&a, 1.5, 2.0);
+            PRNG_FillNormal(&b, result, length, 1.5, 2.0);
+
+            if(memcmp(expected, result, length * sizeof(double)) != 0 ||
+                PRNG_Next(&a) != PRNG_Next(&b))
+            {
+                printf("FAIL normal %s length %u\n", names[type], (unsigned)length);
+                errors++;
+            }
+        }
+    }
+
+    /* Floats and doubles have to stay under 1.0. The biggest number from the
+    PRNG is where dividing by 2^32 would have rounded up. */
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        float maxFloat = 0;
+        double maxDouble = 0;
+
+        PRNG_Create(&a, type);
+        PRNG_Seed(&a, 5);
+        for(uint32_t i = 0; i < 1000000; i++)
+        {
+            float f = PRNG_NextFloat01(&a);
+            double d = PRNG_NextDouble01(&a);
+            if(f < 0 || f >= 1.0f || d < 0 || d >= 1.0)
+            {
+                printf("FAIL %s out of range %.9g %.17g\n", names[type], f, d);
+                errors++;
+                break;
+            }
+            maxFloat = (f > maxFloat) ? f : maxFloat;
+            maxDouble = (d > maxDouble) ? d : maxDouble;
+        }
+        if(maxFloat < 0.999f || maxDouble < 0.999)
+        {
+            printf("FAIL %s never got close to 1\n", names[type]);
+            errors++;
+        }
+    }
+
+    /* The shape of the bell curve. With 16 million numbers, the mean should be
+    within 0.001 and the variance within 0.002. The kurtosis of a normal
+    distribution is 3. Bins are 0.25 wide from -4 to 4, plus one for each
+    tail. Chi-square with 33 degrees of freedom is over 63.9 one time in
+    1000. */
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        uint32_t count[NUM_BINS + 2] = {0};
+        double sum = 0, sumSquares = 0, sumFourth = 0;
+        uint64_t numTail = 0;
+        size_t numNormal = numValues;
+        double *values = malloc(numNormal * sizeof(double));
+
+        PRNG_Create(&a, type);
+        PRNG_Seed(&a, 2024);
+        PRNG_FillNormal(&a, values, numNormal, 0, 1);
+
+        for(size_t i = 0; i < numNormal; i++)
+        {
+            double x = values[i];
+            int32_t bin = (int32_t)floor(x / BIN_WIDTH) + NUM_BINS / 2 + 1;
+
+            if(bin < 0)
+                bin = 0;
+            if(bin > NUM_BINS + 1)
+                bin = NUM_BINS + 1;
+            count[bin]++;
+
+            sum += x;
+            sumSquares += x * x;
+            sumFourth += x * x * x * x;
+            if(fabs(x) > 3.6541528853610088)
+                numTail++;
+        }
+        free(values);
+
+        double mean = sum / numNormal;
+        double variance = sumSquares / numNormal - mean * mean;
+        double kurtosis = sumFourth / numNormal / (variance * variance);
+        double expectedTail = 2.0 * NormalCDF(-3.6541528853610088) * numNormal;
+        double chiSquare = 0;
+
+        for(int32_t bin = 0; bin < NUM_BINS + 2; bin++)
+        {
+            double low = (bin == 0) ? -INFINITY : (bin - 1 - NUM_BINS / 2) * BIN_WIDTH;
+            double high = (bin == NUM_BINS + 1) ? INFINITY : (bin - NUM_BINS / 2) * BIN_WIDTH;
+            double expectedCount = (NormalCDF(high) - NormalCDF(low)) * numNormal;
+            double diff = count[bin] - expectedCount;
+            chiSquare += diff * diff / expectedCount;
+        }
+
+        /* The tail count is Poisson. Allow five standard deviations. */
+        if(fabs(mean) > 4.0 / sqrt(numNormal) || fabs(variance - 1) > 8.0 / sqrt(numNormal) ||
+            fabs(kurtosis - 3) > 50.0 / sqrt(numNormal) ||
+            fabs(numTail - expectedTail) > 5 * sqrt(expectedTail) + 1 || chiSquare > 63.9)
+        {
+            printf("FAIL normal %s mean %.5f variance %.5f kurtosis %.4f tail %u/%.0f "
+                "chi-square %.1f\n", names[type], mean, variance, kurtosis, (unsigned)numTail,
+                expectedTail, chiSquare);
+            errors++;
+        }
+    }
+
+    printf("type,divide ns,PRNG_NextFloat01 ns,PRNG_FillFloat01 ns,PRNG_NextDouble01 ns,"
+           "PRNG_FillDouble01 ns,Box-Muller ns,PRNG_NextNormal ns,PRNG_FillNormal ns\n");
+
+    float *floats = malloc(numValues * sizeof(float));
+    double *doubles = malloc(numValues * sizeof(double));
+
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        double seconds[8];
+
+        PRNG_Create(&a, type);
+        PRNG_Seed(&a, 1);
+
+        for(uint32_t test = 0; test < 8; test++)
+        {
+            double start = Seconds();
+
+            switch(test)
+            {
+                case 0:
+                    for(size_t i = 0; i < numValues; i++)
+                        floats[i] = PRNG_Next(&a) / 4294967296.0f;
+                    sink += floats[numValues - 1];
+                    break;
+                case 1:
+                    for(size_t i = 0; i < numValues; i++)
+                        floats[i] = PRNG_NextFloat01(&a);
+                    sink += floats[numValues - 1];
+                    break;
+                case 2:
+                    PRNG_FillFloat01(&a, floats, numValues);
+                    sink += floats[numValues - 1];
+                    break;
+                case 3:
+                    for(size_t i = 0; i < numValues; i++)
+                        doubles[i] = PRNG_NextDouble01(&a);
+                    sink += doubles[numValues - 1];
+                    break;
+                case 4:
+                    PRNG_FillDouble01(&a, doubles, numValues);
+                    sink += doubles[numValues - 1];
+                    break;
+                case 5:
+                    for(size_t i = 0; i < numValues; i++)
+                        doubles[i] = BoxMuller(&a);
+                    sink += doubles[numValues - 1];
+                    break;
+                case 6:
+                    for(size_t i = 0; i < numValues; i++)
+                        doubles[i] = PRNG_NextNormal(&a, 0, 1);
+                    sink += doubles[numValues - 1];
+                    break;
+                default:
+                    PRNG_FillNormal(&a, doubles, numValues, 0, 1);
+                    sink += doubles[numValues - 1];
+                    break;
+            }
+            seconds[test] = Seconds() - start;
+        }
+
+        printf("%s", names[type]);
+        for(uint32_t test = 0; test < 8; test++)
+            printf(",%.3f", seconds[test] * 1e9 / numValues);
+        printf("\n");
+    }
+    free(floats);
+    free(doubles);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
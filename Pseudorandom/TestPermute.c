@@ -0,0 +1,259 @@
+/* Program to test the shuffle, index shuffle, permute, and parallel shuffle - MS
+
+   Checks that PRNG_Shuffle gives the same order as a plain Fisher-Yates that
+   picks one index at a time with PRNG_NextBounded, for lots of element sizes.
+   Checks that PRNG_ShuffleIndex followed by PRNG_Permute gives that same
+   order too, and leaves the index array alone. Checks that every order of
+   four elements comes up about the same number of times. For the parallel
+   shuffle, checks that the answer doesn't change with the number of threads,
+   that nothing is lost, and that the elements from the first block end up
+   spread out evenly. Then times everything against the plain version.
+   Returns 1 if anything doesn't match.
+
+   gcc -O2 -pthread TestPermute.c PRNG.c PRNG_Parallel.c -o TestPermute -lm
+   ./TestPermute [numElements] [maxThreads] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "PRNG.h"
+#include "PRNG_Parallel.h"
+
+#define DEFAULT_NUM_ELEMENTS    (16UL * 1024 * 1024)
+#define BIG_ELEMENT_SIZE        256
+#define NUM_SPREAD_BINS         16
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* The way it used to be done, one index and three copies at a time */
+static void PlainShuffle(void *array, uint32_t n, size_t s, uint32_t seed)
+{
+    uint8_t tmp[s];
+    uint8_t *arrayPtr = array;
+    PRNG prng;
+
+    PRNG_Create(&prng, PRNG_TYPE_PCG32);
+    PRNG_Seed(&prng, seed);
+
+    for(uint32_t i = (n > 0) ? n - 1 : 0; i > 0; i--)
+    {
+        uint32_t j = PRNG_NextBounded(&prng, 0, i);
+        memcpy(tmp, arrayPtr + (size_t)j * s, s);
+        memcpy(arrayPtr + (size_t)j * s, arrayPtr + (size_t)i * s, s);
+        memcpy(arrayPtr + (size_t)i * s, tmp, s);
+    }
+}
+
+static void FillPattern(uint8_t *array, uint32_t n, size_t s)
+{
+    for(size_t i = 0; i < n * s; i++)
+        array[i] = (uint8_t)(i * 7 + i / 251);
+}
+
+static bool IsPermutation(const uint32_t *array, uint32_t n, uint8_t *seen)
+{
+    memset(seen, 0, n);
+    for(uint32_t i = 0; i < n; i++)
+    {
+        if(array[i] >= n || seen[array[i]])
+            return false;
+        seen[array[i]] = 1;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t sizes[] = {1, 3, 4, 8, 24, 64, 100, 200};
+    const uint32_t lengths[] = {0, 1, 2, 17, 255, 256, 257, 1000, 5000};
+    uint32_t numElements = DEFAULT_NUM_ELEMENTS;
+    uint32_t maxThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    int errors = 0;
+    PRNG prng;
+
+    if(argc > 1)
+        numElements = strtoul(argv[1], NULL, 0);
+    if(argc > 2)
+        maxThreads = strtoul(argv[2], NULL, 0);
+    if(maxThreads < 4)
+        maxThreads = 4;
+
+    uint8_t *a = malloc(5000 * 200);
+    uint8_t *b = malloc(5000 * 200);
+    uint8_t *c = malloc(5000 * 200);
+    uint32_t *index = malloc(5000 * sizeof(uint32_t));
+    uint32_t *indexCopy = malloc(5000 * sizeof(uint32_t));
+
+    for(uint32_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++)
+    {
+        for(uint32_t li = 0; li < sizeof(lengths) / sizeof(lengths[0]); li++)
+        {
+            size_t s = sizes[si];
+            uint32_t n = lengths[li];
+            uint32_t seed = n * 31 + s;
+
+            FillPattern(a, n, s);
+            FillPattern(b, n, s);
+            FillPattern(c, n, s);
+
+            PlainShuffle(a, n, s, seed);
+            PRNG_Shuffle(b, n, s, seed);
+
+            PRNG_Create(&prng, PRNG_TYPE_PCG32);
+            PRNG_Seed(&prng, seed);
+            PRNG_ShuffleIndex(&prng, index, n);
+            memcpy(indexCopy, index, n * sizeof(uint32_t));
+            PRNG_Permute(c, index, n, s);
+
+            if(memcmp(a, b, n * s) != 0)
+            {
+                printf("FAIL PRNG_Shuffle size %u length %u\n", (unsigned)s, n);
+                errors++;
+            }
+            if(memcmp(a, c, n * s) != 0 || memcmp(index, indexCopy, n * sizeof(uint32_t)) != 0)
+            {
+                printf("FAIL PRNG_Permute size %u length %u\n", (unsigned)s, n);
+                errors++;
+            }
+        }
+    }
+
+    /* There are 24 orders of four elements. Chi-square with 23 degrees of
+    freedom is over 49.7 one time in 1000. */
+    uint32_t counts[4 * 4 * 4 * 4] = {0};
+    uint32_t numTries = 240000;
+    for(uint32_t t = 0; t < numTries; t++)
+    {
+        uint8_t order[4] = {0, 1, 2, 3};
+        PRNG_Shuffle(order, 4, 1, t + 1);
+        counts[order[0] * 64 + order[1] * 16 + order[2] * 4 + order[3]]++;
+    }
+    double chiSquare = 0;
+    uint32_t numOrders = 0;
+    for(uint32_t i = 0; i < 256; i++)
+    {
+        if(counts[i] == 0)
+            continue;
+        double diff = counts[i] - numTries / 24.0;
+        chiSquare += diff * diff / (numTries / 24.0);
+        numOrders++;
+    }
+    if(numOrders != 24 || chiSquare > 49.7)
+    {
+        printf("FAIL shuffle orders %u chi-square %.1f\n", numOrders, chiSquare);
+        errors++;
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    free(index);
+    free(indexCopy);
+
+    /* The parallel shuffle */
+    uint32_t *first = malloc((size_t)numElements * sizeof(uint32_t));
+    uint32_t *values = malloc((size_t)numElements * sizeof(uint32_t));
+    uint8_t *seen = malloc(numElements);
+
+    for(uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        for(uint32_t i = 0; i < numElements; i++)
+            values[i] = i;
+
+        PRNG_Parallel_Shuffle(values, numElements, sizeof(uint32_t), 1234, numThreads);
+
+        if(numThreads == 1)
+            memcpy(first, values, (size_t)numElements * sizeof(uint32_t));
+        else if(memcmp(first, values, (size_t)numElements * sizeof(uint32_t)) != 0)
+        {
+            printf("FAIL parallel shuffle changed with %u threads\n", numThreads);
+            errors++;
+        }
+    }
+
+    if(!IsPermutation(first, numElements, seen))
+    {
+        printf("FAIL parallel shuffle lost an element\n");
+        errors++;
+    }
+
+    /* Where did the elements that started in the first 1/16th end up? Chi-
+    square with 15 degrees of freedom is over 37.7 one time in 1000. */
+    uint32_t spread[NUM_SPREAD_BINS] = {0};
+    uint32_t numTracked = 0;
+    for(uint32_t i = 0; i < numElements; i++)
+    {
+        if(first[i] < numElements / NUM_SPREAD_BINS)
+        {
+            spread[(uint64_t)i * NUM_SPREAD_BINS / numElements]++;
+            numTracked++;
+        }
+    }
+    chiSquare = 0;
+    for(uint32_t i = 0; i < NUM_SPREAD_BINS; i++)
+    {
+        double diff = spread[i] - (double)numTracked / NUM_SPREAD_BINS;
+        chiSquare += diff * diff / ((double)numTracked / NUM_SPREAD_BINS);
+    }
+    if(chiSquare > 37.7)
+    {
+        printf("FAIL parallel shuffle spread chi-square %.1f\n", chiSquare);
+        errors++;
+    }
+
+    /* Timing. 4 byte elements, then big ones */
+    printf("test,elements,element size,seconds\n");
+
+    for(uint32_t i = 0; i < numElements; i++)
+        values[i] = i;
+    double start = Seconds();
+    PlainShuffle(values, numElements, sizeof(uint32_t), 1);
+    printf("plain,%u,4,%.3f\n", numElements, Seconds() - start);
+
+    start = Seconds();
+    PRNG_Shuffle(values, numElements, sizeof(uint32_t), 1);
+    printf("PRNG_Shuffle,%u,4,%.3f\n", numElements, Seconds() - start);
+
+    for(uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        start = Seconds();
+        PRNG_Parallel_Shuffle(values, numElements, sizeof(uint32_t), 1, numThreads);
+        printf("PRNG_Parallel_Shuffle %u threads,%u,4,%.3f\n", numThreads, numElements,
+            Seconds() - start);
+    }
+    free(first);
+    free(seen);
+
+    uint32_t numBig = numElements / (BIG_ELEMENT_SIZE / sizeof(uint32_t));
+    uint8_t *big = malloc((size_t)numBig * BIG_ELEMENT_SIZE);
+    FillPattern(big, numBig, BIG_ELEMENT_SIZE);
+
+    start = Seconds();
+    PlainShuffle(big, numBig, BIG_ELEMENT_SIZE, 1);
+    printf("plain,%u,%u,%.3f\n", numBig, BIG_ELEMENT_SIZE, Seconds() - start);
+
+    start = Seconds();
+    PRNG_Shuffle(big, numBig, BIG_ELEMENT_SIZE, 1);
+    printf("PRNG_Shuffle,%u,%u,%.3f\n", numBig, BIG_ELEMENT_SIZE, Seconds() - start);
+
+    start = Seconds();
+    PRNG_Create(&prng, PRNG_TYPE_PCG32);
+    PRNG_Seed(&prng, 1);
+    PRNG_ShuffleIndex(&prng, values, numBig);
+    PRNG_Permute(big, values, numBig, BIG_ELEMENT_SIZE);
+    printf("PRNG_ShuffleIndex + PRNG_Permute,%u,%u,%.3f\n", numBig, BIG_ELEMENT_SIZE,
+        Seconds() - start);
+
+    free(big);
+    free(values);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
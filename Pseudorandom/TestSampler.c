@@ -0,0 +1,361 @@
+/* Program to test the alias sampler and the reservoir sampler - MS
+
+   Alias: for different lists of weights, checks that the table gives every
+   index exactly its share when every column and height is counted up, that
+   a weight of 0 never comes up, and that picks come out in the right
+   proportions. Checks that weights that add up to too much are refused.
+   Then times a pick against searching the running total.
+
+   Reservoir: runs lots of short streams and checks that every item ends up
+   in the reservoir about k / n of the time, that nothing is picked twice,
+   and that adding an array, adding one at a time, and skipping ahead all
+   pick the same items. Then counts how many random numbers a long stream
+   needs, compared to k * (1 + ln(n / k)), and times it against Algorithm R.
+   Returns 1 if anything doesn't match.
+
+   gcc -O2 TestSampler.c Sampler.c PRNG.c -o TestSampler -lm
+   ./TestSampler [numPicks] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "PRNG.h"
+#include "Sampler.h"
+
+#define DEFAULT_NUM_PICKS   (4UL * 1024 * 1024)
+#define MAX_WEIGHTS         1000
+#define STREAM_LENGTH       200
+#define RESERVOIR_SIZE      10
+#define NUM_STREAMS         100000
+#define LONG_STREAM_LENGTH  (64UL * 1024 * 1024)
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* The old way. Binary search the running total for a random number. */
+static uint32_t SearchNext(const uint64_t *runningTotal, uint32_t n, PRNG *prng)
+{
+    uint32_t r = PRNG_NextBounded(prng, 0, (uint32_t)(runningTotal[n - 1] - 1));
+    uint32_t low = 0, high = n - 1;
+
+    while(low < high)
+    {
+        uint32_t middle = (low + high) / 2;
+        if(r < runningTotal[middle])
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    return low;
+}
+
+/* Chi-square critical values one time in 1000, close enough for these */
+static double ChiSquareLimit(uint32_t degrees)
+{
+    return degrees + 3.1 * sqrt(2.0 * degrees) + 10;
+}
+
+int main(int argc, char *argv[])
+{
+    static uint32_t weights[MAX_WEIGHTS], threshold[MAX_WEIGHTS], alias[MAX_WEIGHTS];
+    static uint32_t work[MAX_WEIGHTS];
+    static uint64_t share[MAX_WEIGHTS], runningTotal[MAX_WEIGHTS];
+    static uint32_t counts[MAX_WEIGHTS];
+    size_t numPicks = DEFAULT_NUM_PICKS;
+    volatile uint32_t sink = 0;
+    int errors = 0;
+    SamplerAlias sampler;
+    PRNG prng;
+
+    if(argc > 1)
+        numPicks = strtoull(argv[1], NULL, 0);
+
+    PRNG_Create(&prng, PRNG_TYPE_PCG32);
+    PRNG_Seed(&prng, 42);
+
+    /* 0 is a list of small weights with some zeros, 1 is one weight, 2 adds
+    up to exactly 2^32 - 1, 3 is one huge weight and a lot of tiny ones, and
+    4 is random weights */
+    for(uint32_t test = 0; test < 5; test++)
+    {
+        uint32_t n = 0;
+
+        switch(test)
+        {
+            case 0:
+                {
+                    const uint32_t list[] = {1, 2, 3, 4, 0, 10, 0, 7};
+                    n = sizeof(list) / sizeof(list[0]);
+                    memcpy(weights, list, sizeof(list));
+                }
+                break;
+            case 1:
+                n = 1;
+                weights[0] = 5;
+                break;
+            case 2:
+                n = 3;
+                weights[0] = 0x80000000;
+                weights[1] = 0x7FFFFFFE;
+                weights[2] = 1;
+                break;
+            case 3:
+                n = MAX_WEIGHTS;
+                for(uint32_t i = 0; i < n; i++)
+                    weights[i] = 1;
+                weights[17] = 1000000;
+                break;
+            default:
+                n = MAX_WEIGHTS;
+                for(uint32_t i = 0; i < n; i++)
+                    weights[i] = PRNG_NextBounded(&prng, 0, 100000);
+                break;
+        }
+
+        if(!Sampler_AliasCreate(&sampler, weights, n, threshold, alias, work))
+        {
+            printf("FAIL alias test %u refused\n", test);
+            errors++;
+            continue;
+        }
+
+        /* Add up how much of every column belongs to each index. It has to
+        be exactly weight * n. */
+        memset(share, 0, sizeof(share));
+        for(uint32_t i = 0; i < n; i++)
+        {
+            if(threshold[i] > sampler.total || alias[i] >= n)
+            {
+                printf("FAIL alias test %u column %u is broken\n", test, i);
+                errors++;
+                break;
+            }
+            share[i] += threshold[i];
+            share[alias[i]] += sampler.total - threshold[i];
+        }
+        for(uint32_t i = 0; i < n; i++)
+        {
+            if(share[i] != (uint64_t)weights[i] * n)
+            {
+                printf("FAIL alias test %u index %u share %llu should be %llu\n", test, i,
+                    (unsigned long long)share[i], (unsigned long long)weights[i] * n);
+                errors++;
+                break;
+            }
+        }
+
+        /* Now pick a lot and see if they come out right. Indexes with a tiny
+        chance are left out of the chi-square. */
+        memset(counts, 0, sizeof(counts));
+        for(size_t p = 0; p < numPicks; p++)
+            counts[Sampler_AliasNext(&sampler, &prng)]++;
+
+        double chiSquare = 0;
+        uint32_t degrees = 0;
+        for(uint32_t i = 0; i < n; i++)
+        {
+            double expected = (double)weights[i] / sampler.total * numPicks;
+
+            if(weights[i] == 0 && counts[i] != 0)
+            {
+                printf("FAIL alias test %u picked weight 0 at %u\n", test, i);
+                errors++;
+            }
+            if(expected < 5)
+                continue;
+
+            chiSquare += (counts[i] - expected) * (counts[i] - expected) / expected;
+            degrees++;
+        }
+        if(degrees > 1 && chiSquare > ChiSquareLimit(degrees - 1))
+        {
+            printf("FAIL alias test %u chi-square %.1f with %u\n", test, chiSquare, degrees - 1);
+            errors++;
+        }
+    }
+
+    weights[0] = 0x80000000;
+    weights[1] = 0x80000000;
+    if(Sampler_AliasCreate(&sampler, weights, 2, threshold, alias, work) ||
+        Sampler_AliasCreate(&sampler, weights, 0, threshold, alias, work))
+    {
+        printf("FAIL alias took weights that add up to too much\n");
+        errors++;
+    }
+
+    /* Every item in a short stream should end up in the reservoir about
+    k / n of the time */
+    uint32_t stream[STREAM_LENGTH];
+    uint32_t reservoirA[RESERVOIR_SIZE], reservoirB[RESERVOIR_SIZE], reservoirC[RESERVOIR_SIZE];
+    uint32_t inclusion[STREAM_LENGTH] = {0};
+    SamplerReservoir a, b, c;
+    PRNG prngA, prngB, prngC;
+
+    for(uint32_t i = 0; i < STREAM_LENGTH; i++)
+        stream[i] = i;
+
+    for(uint32_t t = 0; t < NUM_STREAMS; t++)
+    {
+        PRNG_Create(&prngA, PRNG_TYPE_XOSHIRO256);
+        PRNG_Seed(&prngA, t + 1);
+        prngB = prngC = prngA;
+
+        Sampler_ReservoirCreate(&a, &prngA, reservoirA, RESERVOIR_SIZE, sizeof(uint32_t));
+        Sampler_ReservoirCreate(&b, &prngB, reservoirB, RESERVOIR_SIZE, sizeof(uint32_t));
+        Sampler_ReservoirCreate(&c, &prngC, reservoirC, RESERVOIR_SIZE, sizeof(uint32_t));
+
+        Sampler_ReservoirAddArray(&a, stream, STREAM_LENGTH);
+
+        for(uint32_t i = 0; i < STREAM_LENGTH; i++)
+            Sampler_ReservoirAdd(&b, &stream[i]);
+
+        for(uint32_t i = 0; i < STREAM_LENGTH;)
+        {
+            uint64_t skip = Sampler_ReservoirGetSkip(&c);
+            if(skip >= STREAM_LENGTH - i)
+            {
+                Sampler_ReservoirSkip(&c, STREAM_LENGTH - i);
+                break;
+            }
+            Sampler_ReservoirSkip(&c, skip);
+            i += skip;
+            Sampler_ReservoirAdd(&c, &stream[i++]);
+        }
+
+        if(memcmp(reservoirA, reservoirB, sizeof(reservoirA)) != 0 ||
+            memcmp(reservoirA, reservoirC, sizeof(reservoirA)) != 0 ||
+            Sampler_ReservoirGetCount(&a) != STREAM_LENGTH ||
+            Sampler_ReservoirGetCount(&c) != STREAM_LENGTH ||
+            Sampler_ReservoirGetSize(&a) != RESERVOIR_SIZE)
+        {
+            printf("FAIL reservoir stream %u add, add array, and skip don't match\n", t);
+            errors++;
+            break;
+        }
+
+        for(uint32_t i = 0; i < RESERVOIR_SIZE; i++)
+        {
+            for(uint32_t j = i + 1; j < RESERVOIR_SIZE; j++)
+            {
+                if(reservoirA[i] == reservoirA[j])
+                {
+                    printf("FAIL reservoir stream %u picked %u twice\n", t, reservoirA[i]);
+                    errors++;
+                }
+            }
+            inclusion[reservoirA[i]]++;
+        }
+    }
+
+    double chiSquare = 0;
+    double expected = (double)NUM_STREAMS * RESERVOIR_SIZE / STREAM_LENGTH;
+    for(uint32_t i = 0; i < STREAM_LENGTH; i++)
+        chiSquare += (inclusion[i] - expected) * (inclusion[i] - expected) / expected;
+    if(chiSquare > ChiSquareLimit(STREAM_LENGTH - 1))
+    {
+        printf("FAIL reservoir chi-square %.1f\n", chiSquare);
+        errors++;
+    }
+
+    /* A stream shorter than the reservoir keeps everything */
+    Sampler_ReservoirCreate(&a, &prngA, reservoirA, RESERVOIR_SIZE, sizeof(uint32_t));
+    Sampler_ReservoirAddArray(&a, stream, 3);
+    if(Sampler_ReservoirGetSize(&a) != 3 || reservoirA[0] != 0 || reservoirA[2] != 2)
+    {
+        printf("FAIL reservoir short stream\n");
+        errors++;
+    }
+
+    /* Timing. Alias against searching the running total. */
+    printf("test,n,seconds,ns each\n");
+
+    for(uint32_t i = 0; i < MAX_WEIGHTS; i++)
+    {
+        weights[i] = PRNG_NextBounded(&prng, 1, 1000);
+        runningTotal[i] = weights[i] + ((i > 0) ? runningTotal[i - 1] : 0);
+    }
+    Sampler_AliasCreate(&sampler, weights, MAX_WEIGHTS, threshold, alias, work);
+
+    double start = Seconds();
+    for(size_t p = 0; p < numPicks; p++)
+        sink += SearchNext(runningTotal, MAX_WEIGHTS, &prng);
+    double seconds = Seconds() - start;
+    printf("search,%u,%.3f,%.2f\n", MAX_WEIGHTS, seconds, seconds * 1e9 / numPicks);
+
+    start = Seconds();
+    for(size_t p = 0; p < numPicks; p++)
+        sink += Sampler_AliasNext(&sampler, &prng);
+    seconds = Seconds() - start;
+    printf("Sampler_AliasNext,%u,%.3f,%.2f\n", MAX_WEIGHTS, seconds, seconds * 1e9 / numPicks);
+
+    /* A long stream, fed in pieces. Count the replacements to see how many
+    random numbers it took. Algorithm L uses three for each one. */
+    uint32_t *longStream = malloc(LONG_STREAM_LENGTH / 16 * sizeof(uint32_t));
+    for(uint32_t i = 0; i < LONG_STREAM_LENGTH / 16; i++)
+        longStream[i] = i;
+
+    PRNG_Seed(&prngA, 7);
+    Sampler_ReservoirCreate(&a, &prngA, reservoirA, RESERVOIR_SIZE, sizeof(uint32_t));
+
+    uint64_t numReplaced = 0;
+    start = Seconds();
+    for(uint32_t piece = 0; piece < 16; piece++)
+    {
+        for(uint32_t i = 0; i < LONG_STREAM_LENGTH / 16;)
+        {
+            uint64_t skip = Sampler_ReservoirGetSkip(&a);
+            if(skip >= LONG_STREAM_LENGTH / 16 - i)
+            {
+                Sampler_ReservoirSkip(&a, LONG_STREAM_LENGTH / 16 - i);
+                break;
+            }
+            Sampler_ReservoirSkip(&a, skip);
+            i += skip;
+            numReplaced += Sampler_ReservoirAdd(&a, &longStream[i++]);
+        }
+    }
+    seconds = Seconds() - start;
+    double predicted = RESERVOIR_SIZE * (1 + log((double)LONG_STREAM_LENGTH / RESERVOIR_SIZE));
+    printf("Algorithm L,%lu,%.6f,%.4f\n", LONG_STREAM_LENGTH, seconds,
+        seconds * 1e9 / LONG_STREAM_LENGTH);
+    printf("Algorithm L items picked %llu, predicted about %.0f\n",
+        (unsigned long long)numReplaced, predicted);
+
+    if(numReplaced > 2 * predicted || numReplaced < predicted / 2)
+    {
+        printf("FAIL reservoir picked too many or too few\n");
+        errors++;
+    }
+
+    /* Algorithm R. One random number for every item. */
+    PRNG_Seed(&prngB, 7);
+    start = Seconds();
+    for(uint64_t i = 0; i < LONG_STREAM_LENGTH; i++)
+    {
+        uint32_t item = longStream[i % (LONG_STREAM_LENGTH / 16)];
+        if(i < RESERVOIR_SIZE)
+        {
+            reservoirB[i] = item;
+        }
+        else
+        {
+            uint32_t j = PRNG_NextBounded(&prngB, 0, (uint32_t)i);
+            if(j < RESERVOIR_SIZE)
+                reservoirB[j] = item;
+        }
+    }
+    seconds = Seconds() - start;
+    sink += reservoirB[0];
+    printf("Algorithm R,%lu,%.6f,%.4f\n", LONG_STREAM_LENGTH, seconds,
+        seconds * 1e9 / LONG_STREAM_LENGTH);
+    free(longStream);
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}
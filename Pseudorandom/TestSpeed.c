@@ -0,0 +1,150 @@
+/* Program to compare the speed of every PRNG type - MS
+
+   For each type, times PRNG_Next through the PRNG object, the type's own
+   function called directly, PRNG_Fill, and PRNG_Skip. Prints one CSV line
+   per type with nanoseconds and cycles per output. Cycles come from the time
+   stamp counter on x86, so they are at the base clock, not the turbo clock.
+
+   gcc -O2 TestSpeed.c PRNG.c -o TestSpeed -lm
+   ./TestSpeed [numValues] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "PRNG.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES     1
+#else
+#define HAVE_CYCLES     0
+#endif
+
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#define NUM_SKIPS           10000
+
+static double Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t Cycles(void)
+{
+#if HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* Calls the type's function directly. The switch is outside the loop. */
+static uint32_t RunDirect(PRNG *prng, size_t n)
+{
+    uint32_t sum = 0;
+
+    switch(prng->type)
+    {
+        case PRNG_TYPE_LCG_BIG:
+            for(size_t i = 0; i < n; i++)
+                sum += LCGBig_Next(&prng->state.u64);
+            break;
+        case PRNG_TYPE_LCG_SMALL:
+            for(size_t i = 0; i < n; i++)
+                sum += LCGSmall_Next(&prng->state.u32);
+            break;
+        case PRNG_TYPE_PARK_MILLER:
+            for(size_t i = 0; i < n; i++)
+                sum += ParkMiller_Next(&prng->state.u64);
+            break;
+        case PRNG_TYPE_SCHRAGE:
+            for(size_t i = 0; i < n; i++)
+                sum += Schrage_Next(&prng->state.u32);
+            break;
+        case PRNG_TYPE_PCG32:
+            for(size_t i = 0; i < n; i++)
+                sum += PCG32_Next(&prng->state.u64);
+            break;
+        case PRNG_TYPE_XOSHIRO256:
+            for(size_t i = 0; i < n; i++)
+                sum += Xoshiro256_Next(prng->state.u64x4) >> 32;
+            break;
+        case PRNG_TYPE_SPLITMIX64:
+            for(size_t i = 0; i < n; i++)
+                sum += SplitMix64_Next(&prng->state.u64) >> 32;
+            break;
+    }
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *names[] = {"LCG Big", "LCG Small", "Park Miller", "Schrage", "PCG32",
+                           "xoshiro256**", "SplitMix64"};
+    size_t numValues = DEFAULT_NUM_VALUES;
+    volatile uint32_t sink = 0;
+    PRNG prng;
+
+    if(argc > 1)
+        numValues = strtoull(argv[1], NULL, 0);
+
+    uint32_t *values = malloc(numValues * sizeof(uint32_t));
+
+    printf("type,PRNG_Next ns,PRNG_Next cycles,direct ns,direct cycles,"
+           "PRNG_Fill ns,PRNG_Fill cycles,PRNG_Skip ns\n");
+
+    for(PRNGType type = PRNG_TYPE_LCG_BIG; type <= PRNG_TYPE_SPLITMIX64; type++)
+    {
+        double seconds[3];
+        uint64_t cycles[3];
+        uint32_t sum = 0;
+
+        PRNG_Create(&prng, type);
+        PRNG_Seed(&prng, 12345);
+
+        for(uint32_t test = 0; test < 3; test++)
+        {
+            double start = Seconds();
+            uint64_t startCycles = Cycles();
+
+            if(test == 0)
+            {
+                for(size_t i = 0; i < numValues; i++)
+                    sum += PRNG_Next(&prng);
+            }
+            else if(test == 1)
+            {
+                sum += RunDirect(&prng, numValues);
+            }
+            else
+            {
+                PRNG_Fill(&prng, values, numValues);
+                sum += values[numValues - 1];
+            }
+
+            cycles[test] = Cycles() - startCycles;
+            seconds[test] = Seconds() - start;
+        }
+
+        /* Skip a different distance each time so it can't be skipped */
+        double start = Seconds();
+        for(int64_t i = 1; i <= NUM_SKIPS; i++)
+            sum += PRNG_Skip(&prng, i * 1000003);
+        double skipTime = Seconds() - start;
+        sink += sum;
+
+        printf("%s", names[type]);
+        for(uint32_t test = 0; test < 3; test++)
+        {
+            printf(",%.3f,", seconds[test] * 1e9 / numValues);
+            if(HAVE_CYCLES)
+                printf("%.2f", (double)cycles[test] / numValues);
+            else
+                printf("n/a");
+        }
+        printf(",%.1f\n", skipTime * 1e9 / NUM_SKIPS);
+    }
+    free(values);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/* Program to test PRNG_DEFINE against the PRNG object - MS
+
+   Makes a PRNG_DEFINE struct for every type and checks that Next,
+   NextBounded, and Skip give the same numbers as the PRNG object with the
+   same seed. Then times both ways, one number per call, and prints one CSV
+   line per type with nanoseconds and cycles per call. Returns 1 if anything
+   doesn't match.
+
+   Cycles come from the time stamp counter on x86. On a Cortex-M3, M4, M7,
+   or M33, they come from the DWT cycle counter instead, which counts every
+   core clock. There is no clock_gettime there, so the nanoseconds are left
+   out, and printf has to go somewhere (retarget it to a UART). Call main
+   from your own startup code. The counter is only 32 bits, so keep the
+   number of values small enough that it doesn't roll over.
+
+   gcc -O2 TestStatic.c PRNG.c -o TestStatic -lm
+   ./TestStatic [numValues] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "PRNG.h"
+#include "PRNG_Static.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <time.h>
+#include <x86intrin.h>
+#define HAVE_CYCLES         1
+#define HAVE_SECONDS        1
+#define CYCLES_MASK         UINT64_MAX
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define DEMCR               (*(volatile uint32_t *)0xE000EDFCUL)
+#define DEMCR_TRCENA        (1UL << 24)
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+#define DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004UL)
+#define HAVE_CYCLES         1
+#define HAVE_SECONDS        0
+#define CYCLES_MASK         0xFFFFFFFFUL
+#define DEFAULT_NUM_VALUES  (10UL * 1000)
+#else
+#include <time.h>
+#define HAVE_CYCLES         0
+#define HAVE_SECONDS        1
+#define CYCLES_MASK         0
+#define DEFAULT_NUM_VALUES  (16UL * 1024 * 1024)
+#endif
+
+#define NUM_CHECKS          1000
+
+PRNG_DEFINE(StaticLCGBig, PRNG_TYPE_LCG_BIG)
+PRNG_DEFINE(StaticLCGSmall, PRNG_TYPE_LCG_SMALL)
+PRNG_DEFINE(StaticParkMiller, PRNG_TYPE_PARK_MILLER)
+PRNG_DEFINE(StaticSchrage, PRNG_TYPE_SCHRAGE)
+PRNG_DEFINE(StaticPCG32, PRNG_TYPE_PCG32)
+PRNG_DEFINE(StaticXoshiro256, PRNG_TYPE_XOSHIRO256)
+PRNG_DEFINE(StaticSplitMix64, PRNG_TYPE_SPLITMIX64)
+
+static double Seconds(void)
+{
+#if HAVE_SECONDS
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+#else
+    return 0;
+#endif
+}
+
+static void CyclesInit(void)
+{
+#if HAVE_CYCLES && !HAVE_SECONDS
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+#endif
+}
+
+static uint64_t Cycles(void)
+{
+#if HAVE_CYCLES && HAVE_SECONDS
+    return __rdtsc();
+#elif HAVE_CYCLES
+    return DWT_CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+static size_t numValues = DEFAULT_NUM_VALUES;
+static volatile uint32_t sink;
+static int errors;
+
+static void PrintTime(double seconds, uint64_t cycles)
+{
+    if(HAVE_SECONDS)
+        printf(",%.3f", seconds * 1e9 / numValues);
+    else
+        printf(",n/a");
+
+    if(HAVE_CYCLES)
+        printf(",%.2f", (double)cycles / numValues);
+    else
+        printf(",n/a");
+}
+
+/* The same checks and timing for every type. The loops call the functions
+one number at a time on purpose, since that is what the switch costs. */
+#define TEST_TYPE(name, type, typeName) \
+static void Test_##name(void) \
+{ \
+    const uint32_t seeds[] = {0, 1, 12345, 0x80000000, 0xFFFFFFFF}; \
+    double seconds[4]; \
+    uint64_t cycles[4]; \
+    uint32_t sum = 0; \
+    PRNG prng; \
+    name fast; \
+\
+    for(uint32_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]); s++) \
+    { \
+        PRNG_Create(&prng, type); \
+        PRNG_Seed(&prng, seeds[s]); \
+        name##_Seed(&fast, seeds[s]); \
+\
+        for(uint32_t i = 0; i < NUM_CHECKS; i++) \
+        { \
+            if(PRNG_Next(&prng) != name##_Next(&fast) || \
+                PRNG_NextBounded(&prng, 0, i) != name##_NextBounded(&fast, 0, i) || \
+                PRNG_NextBounded(&prng, 7, 0x80000000) != \
+                name##_NextBounded(&fast, 0x80000000, 7) || \
+                PRNG_NextBounded(&prng, 0, 0xFFFFFFFF) != \
+                name##_NextBounded(&fast, 0, 0xFFFFFFFF)) \
+            { \
+                printf("FAIL %s seed 0x%X number %u\n", typeName, seeds[s], i); \
+                errors++; \
+                break; \
+            } \
+        } \
+\
+        for(int64_t n = -5; n < 5; n++) \
+        { \
+            if(PRNG_Skip(&prng, n * 100003) != name##_Skip(&fast, n * 100003) || \
+                PRNG_Next(&prng) != name##_Next(&fast)) \
+            { \
+                printf("FAIL %s seed 0x%X skip %d\n", typeName, seeds[s], (int)n); \
+                errors++; \
+                break; \
+            } \
+        } \
+    } \
+\
+    PRNG_Seed(&prng, 1); \
+    name##_Seed(&fast, 1); \
+\
+    for(uint32_t test = 0; test < 4; test++) \
+    { \
+        double start = Seconds(); \
+        uint64_t startCycles = Cycles(); \
+\
+        if(test == 0) \
+        { \
+            for(size_t i = 0; i < numValues; i++) \
+                sum += PRNG_Next(&prng); \
+        } \
+        else if(test == 1) \
+        { \
+            for(size_t i = 0; i < numValues; i++) \
+                sum += name##_Next(&fast); \
+        } \
+        else if(test == 2) \
+        { \
+            for(size_t i = 0; i < numValues; i++) \
+                sum += PRNG_NextBounded(&prng, 1, 6); \
+        } \
+        else \
+        { \
+            for(size_t i = 0; i < numValues; i++) \
+                sum += name##_NextBounded(&fast, 1, 6); \
+        } \
+\
+        cycles[test] = (Cycles() - startCycles) & CYCLES_MASK; \
+        seconds[test] = Seconds() - start; \
+    } \
+    sink += sum; \
+\
+    printf("%s", typeName); \
+    for(uint32_t test = 0; test < 4; test++) \
+        PrintTime(seconds[test], cycles[test]); \
+    printf("\n"); \
+}
+
+TEST_TYPE(StaticLCGBig, PRNG_TYPE_LCG_BIG, "LCG Big")
+TEST_TYPE(StaticLCGSmall, PRNG_TYPE_LCG_SMALL, "LCG Small")
+TEST_TYPE(StaticParkMiller, PRNG_TYPE_PARK_MILLER, "Park Miller")
+TEST_TYPE(StaticSchrage, PRNG_TYPE_SCHRAGE, "Schrage")
+TEST_TYPE(StaticPCG32, PRNG_TYPE_PCG32, "PCG32")
+TEST_TYPE(StaticXoshiro256, PRNG_TYPE_XOSHIRO256, "xoshiro256**")
+TEST_TYPE(StaticSplitMix64, PRNG_TYPE_SPLITMIX64, "SplitMix64")
+
+int main(int argc, char *argv[])
+{
+    if(argc > 1)
+        numValues = strtoull(argv[1], NULL, 0);
+
+    CyclesInit();
+
+    printf("type,PRNG_Next ns,PRNG_Next cycles,static Next ns,static Next cycles,"
+           "PRNG_NextBounded ns,PRNG_NextBounded cycles,"
+           "static NextBounded ns,static NextBounded cycles\n");
+
+    Test_StaticLCGBig();
+    Test_StaticLCGSmall();
+    Test_StaticParkMiller();
+    Test_StaticSchrage();
+    Test_StaticPCG32();
+    Test_StaticXoshiro256();
+    Test_StaticSplitMix64();
+
+    printf(errors ? "FAIL\n" : "PASS\n");
+    return errors ? 1 : 0;
+}